@@ -0,0 +1,50 @@
+#include <bench/Bench.hpp>
+#include <bench/Games.hpp>
+#include <bench/Suites.hpp>
+#include <engine/Autopilot.hpp>
+#include <sstream>
+
+namespace app::bench {
+
+void autopilot() {
+    for (const unsigned int boardSize : {13u, 64u, 256u, 1024u}) {
+        const size_t length {std::max<size_t>(3, static_cast<size_t>(boardSize) * boardSize / 8)};
+        const size_t decisions {boardSize >= 1024 ? 50u : boardSize >= 256 ? 500u : 5000u};
+
+        auto game {cycleGame(boardSize, length)};
+        engine::Autopilot autopilot {boardSize};
+        size_t games {1};
+
+        // the first decision builds the distance field from scratch
+        const auto begin {std::chrono::steady_clock::now()};
+        autopilot.decide(game);
+        const std::chrono::duration<double, std::nano> rebuild {std::chrono::steady_clock::now() - begin};
+
+        std::chrono::steady_clock::duration deciding {};
+        for (size_t i = 0; i < decisions; ++i) {
+            const auto decisionBegin {std::chrono::steady_clock::now()};
+            const auto direction {autopilot.decide(game)};
+            deciding += std::chrono::steady_clock::now() - decisionBegin;
+
+            game.setNextDirection(direction);
+            if (game.move() != engine::GameState::Running) {
+                game = cycleGame(boardSize, length, ++games);
+                autopilot.reset();
+            }
+        }
+
+        const std::chrono::duration<double, std::nano> perDecision {deciding / decisions};
+        std::ostringstream extra {};
+        extra
+            << std::fixed << std::setprecision(0) << 1e9 / perDecision.count() << " decisions/s, "
+            << rebuild.count() / 1000 << " us full rebuild, " << games << " games";
+
+        report(
+            "board " + std::to_string(boardSize) + ", length " + std::to_string(length) + " decide",
+            {perDecision.count(), perDecision.count(), 0},
+            extra.str()
+        );
+    }
+}
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace app::bench {
+
+struct Measurement {
+    double median; // ns per operation
+    double min;
+    double mad {0}; // median absolute deviation of the samples
+};
+
+struct Result {
+    std::string suite;
+    std::string name;
+    Measurement measurement;
+};
+
+/// Suite being run, results are reported under it
+inline std::string currentSuite {};
+/// Every reported measurement in order, for `--json`
+inline std::vector<Result> results {};
+
+/// Samples per case, `--repeats` changes it
+inline size_t defaultSamples {7};
+
+/// Median, min and MAD of samples in ns, for timings taken outside of `measure()`
+inline Measurement summarize(std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    const auto median {samples[samples.size() / 2]};
+
+    std::vector<double> deviations {};
+    for (const auto value : samples) {
+        deviations.push_back(std::abs(value - median));
+    }
+    std::nth_element(deviations.begin(), deviations.begin() + deviations.size() / 2, deviations.end());
+
+    return {median, samples.front(), deviations[deviations.size() / 2]};
+}
+
+/// Runs `operation` `iterations` times per sample, after one warm-up sample
+template<typename Operation>
+Measurement measure(size_t iterations, Operation&& operation, size_t samples = defaultSamples) {
+    std::vector<double> perOperation {};
+
+    for (size_t sample = 0; sample <= samples; ++sample) {
+        const auto begin {std::chrono::steady_clock::now()};
+        for (size_t i = 0; i < iterations; ++i) {
+            operation();
+        }
+        const std::chrono::duration<double, std::nano> elapsed {std::chrono::steady_clock::now() - begin};
+
+        if (sample > 0) {
+            perOperation.push_back(elapsed.count() / iterations);
+        }
+    }
+
+    return summarize(std::move(perOperation));
+}
+
+inline void report(const std::string& name, const Measurement& measurement, const std::string& extra = {}) {
+    std::cout
+        << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(1)
+        << std::setw(12) << measurement.median << " ns/op"
+        << std::setw(10) << measurement.mad << " mad"
+        << std::setw(12) << measurement.min << " min"
+        << (extra.empty() ? "" : "  ") << extra << std::endl;
+
+    results.push_back({currentSuite, name, measurement});
+}
+
+/// Keeps the optimizer from dropping a computed value
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+}
@@ -0,0 +1,40 @@
+#include <bench/Bench.hpp>
+#include <bench/Suites.hpp>
+#include <util/FrameEncoder.hpp>
+#include <filesystem>
+#include <sstream>
+
+namespace app::bench {
+
+void capture() {
+    // a window on a 1080p screen, 1/1.6 of it
+    constexpr unsigned int width {1200};
+    constexpr unsigned int height {675};
+
+    std::vector<std::byte> frame(static_cast<size_t>(width) * height * 4);
+    for (size_t i = 0; i < frame.size(); ++i) {
+        frame[i] = static_cast<std::byte>(i * 31 / 7);
+    }
+    const auto name {std::to_string(width) + "x" + std::to_string(height)};
+
+    const auto encoding {measure(8, [&] { doNotOptimize(util::FrameEncoder::encodePng(width, height, frame).size()); })};
+    report(name + " png encode", encoding);
+
+    // what the encoder thread sustains, the render thread only pays for the copy in `submit()`
+    const auto directory {std::filesystem::temp_directory_path() / "snake-bench-capture"};
+    for (const auto format : {util::FrameEncoder::Format::Raw, util::FrameEncoder::Format::Png}) {
+        util::FrameEncoder encoder {directory, format, width, height};
+
+        const auto writing {measure(8, [&] {
+            encoder.submit(frame);
+            encoder.flush();
+        })};
+
+        std::ostringstream extra {};
+        extra << static_cast<size_t>(1e9 / writing.median) << " frames per second, " << encoder.dropped() << " dropped";
+        report(name + (format == util::FrameEncoder::Format::Raw ? " raw" : " png") + " frame submit to written", writing, extra.str());
+    }
+    std::filesystem::remove_all(directory);
+}
+
+}
@@ -0,0 +1,67 @@
+#include <bench/Bench.hpp>
+#include <bench/Suites.hpp>
+#include <engine/CompactGame.hpp>
+#include <engine/Engine.hpp>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace app::bench {
+
+namespace {
+
+/// Random playouts of a batch of games, restarted in place when they end, like the environment steps them
+template<typename State>
+Measurement stepBatch(unsigned int boardSize, size_t& episodes) {
+    constexpr size_t count {256};
+
+    std::vector<State> games(count);
+    for (size_t i = 0; i < count; ++i) {
+        games[i] = State{boardSize, static_cast<std::uint32_t>(i + 1)};
+    }
+
+    std::minstd_rand random {1};
+    std::vector<engine::Direction> actions(count * 64);
+    for (auto& action : actions) {
+        action = static_cast<engine::Direction>(random() % 4);
+    }
+
+    size_t batch {0};
+    const auto measurement {measure(256, [&] {
+        const auto* batchActions {actions.data() + (batch++ % 64) * count};
+        for (size_t i = 0; i < count; ++i) {
+            games[i].setNextDirection(batchActions[i]);
+            const auto outcome {games[i].move()};
+            if (outcome == engine::Outcome::Lost || outcome == engine::Outcome::Won) {
+                games[i] = State{boardSize, static_cast<std::uint32_t>(++episodes)};
+            }
+        }
+    })};
+
+    return {measurement.median / count, measurement.min / count, measurement.mad / count};
+}
+
+template<unsigned int BoardSize>
+void compare() {
+    size_t runtimeEpisodes {0}, fixedEpisodes {0};
+    const auto runtime {stepBatch<engine::CompactGame<64>>(BoardSize, runtimeEpisodes)};
+    const auto fixed {stepBatch<engine::Engine<BoardSize, BoardSize>>(BoardSize, fixedEpisodes)};
+
+    const auto name {"board " + std::to_string(BoardSize) + " step"};
+    report(name + ", runtime size", runtime, std::to_string(runtimeEpisodes) + " episodes");
+
+    std::ostringstream extra {};
+    extra << fixedEpisodes << " episodes, " << std::fixed << std::setprecision(2) << runtime.median / fixed.median << "x";
+    report(name + ", fixed size", fixed, extra.str());
+}
+
+}
+
+void fixedEngine() {
+    compare<13>();
+    compare<16>();
+    compare<32>();
+    compare<64>();
+}
+
+}
@@ -0,0 +1,54 @@
+#include <bench/Bench.hpp>
+#include <bench/Suites.hpp>
+#include <env/snake_env.h>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace app::bench {
+
+void environment() {
+    for (const unsigned int boardSize : {13u, 64u}) {
+        for (const size_t count : {1u, 64u, 1024u}) {
+            auto* env {snake_env_create(count, boardSize)};
+            const auto observationWords {snake_env_observation_size(env) / sizeof(std::uint64_t)};
+
+            std::vector<std::uint64_t> observations(count * observationWords);
+            std::vector<float> rewards(count);
+            std::vector<std::uint8_t> dones(count);
+
+            // pre-generated random actions, so the benchmark measures the environment only
+            std::minstd_rand random {1};
+            std::vector<std::uint8_t> actions(count * 64);
+            for (auto& action : actions) {
+                action = static_cast<std::uint8_t>(random() % 4);
+            }
+
+            snake_env_reset(env, 1, observations.data());
+
+            size_t batch {0}, episodes {0};
+            const auto measurement {measure(std::max<size_t>(1, 65536 / count), [&] {
+                snake_env_step(env, actions.data() + (batch++ % 64) * count, observations.data(), rewards.data(), dones.data());
+                for (const auto done : dones) {
+                    episodes += done;
+                }
+            })};
+
+            const auto perEnvironmentStep {measurement.median / static_cast<double>(count)};
+            std::ostringstream extra {};
+            extra
+                << std::fixed << std::setprecision(0) << 1e9 / perEnvironmentStep << " env-steps/s, "
+                << observationWords * sizeof(std::uint64_t) << " bytes/observation, " << episodes << " episodes";
+
+            report(
+                "board " + std::to_string(boardSize) + ", " + std::to_string(count) + " envs step",
+                {perEnvironmentStep, measurement.min / static_cast<double>(count), measurement.mad / static_cast<double>(count)},
+                extra.str()
+            );
+
+            snake_env_destroy(env);
+        }
+    }
+}
+
+}
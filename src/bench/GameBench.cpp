@@ -0,0 +1,87 @@
+#include <bench/Bench.hpp>
+#include <bench/Games.hpp>
+#include <bench/Suites.hpp>
+#include <random>
+#include <sstream>
+
+namespace app::bench {
+
+void game() {
+    constexpr unsigned int boardSize {64};
+    constexpr size_t area {static_cast<size_t>(boardSize) * boardSize};
+
+    // the bump check tests a bit of the occupancy, so moving costs the same at any length
+    for (const size_t length : {4u, 64u, 512u, 2048u, 3072u}) {
+        auto game {cycleGame(boardSize, length)};
+        size_t games {1};
+
+        const auto moving {measure(4096, [&] {
+            cycleMove(game);
+            if (game.state() != engine::GameState::Running) {
+                game = cycleGame(boardSize, length, ++games);
+            }
+        })};
+        report("board 64, length " + std::to_string(length) + " move", moving, std::to_string(games) + " games");
+
+        const auto nextHead {measure(1 << 16, [&] { doNotOptimize(game.getNextHead()); })};
+        report("board 64, length " + std::to_string(length) + " next head", nextHead);
+    }
+
+    // retries a random cell while 1/64 of the board is free, past that scans the occupancy for the n-th free cell
+    for (const unsigned int occupancy : {10u, 50u, 90u, 99u}) {
+        auto game {cycleGame(boardSize, area * occupancy / 100)};
+
+        const auto placing {measure(occupancy >= 90 ? 64 : 1024, [&] {
+            game.placeTreat();
+            doNotOptimize(game.treat());
+        })};
+        report("board 64, " + std::to_string(occupancy) + "% occupied place treat", placing);
+    }
+    {
+        constexpr unsigned int largeBoardSize {1024};
+        auto game {cycleGame(largeBoardSize, static_cast<size_t>(largeBoardSize) * largeBoardSize - 64)};
+
+        const auto placing {measure(64, [&] {
+            game.placeTreat();
+            doNotOptimize(game.treat());
+        })};
+        report("board 1024, 64 free cells place treat", placing);
+    }
+
+    // a lookup hashes the cell and probes a slot or two, however many treats there are
+    for (const size_t count : {1ul, 64ul, 4096ul}) {
+        engine::TreatField treats {count};
+        std::minstd_rand random {1};
+        std::uniform_int_distribution<unsigned int> cell {0, 1023};
+        while (treats.size() < count) {
+            treats.spawn({cell(random), cell(random)});
+        }
+
+        const auto looking {measure(1 << 16, [&] { doNotOptimize(treats.contains({cell(random), cell(random)})); })};
+        report("board 1024, " + std::to_string(count) + " treats contains", looking);
+
+        const auto replacing {measure(1 << 16, [&] {
+            const auto eaten {treats[random() % treats.size()].cell};
+            treats.despawn(eaten);
+            while (!treats.spawn({cell(random), cell(random)})) {}
+        })};
+        report("board 1024, " + std::to_string(count) + " treats despawn and spawn", replacing);
+    }
+
+    for (const size_t count : {1ul, 256ul}) {
+        auto game {cycleGame(boardSize, 64)};
+        game.setTreatCount(count);
+        size_t games {1};
+
+        const auto moving {measure(4096, [&] {
+            cycleMove(game);
+            if (game.state() != engine::GameState::Running) {
+                game = cycleGame(boardSize, 64, ++games);
+                game.setTreatCount(count);
+            }
+        })};
+        report("board 64, length 64, " + std::to_string(count) + " treats move", moving, std::to_string(games) + " games");
+    }
+}
+
+}
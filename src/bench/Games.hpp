@@ -0,0 +1,46 @@
+#pragma once
+
+#include <engine/Game.hpp>
+#include <stdexcept>
+
+namespace app::bench {
+
+/*
+ * Long snakes without playing: every row of the wrapping board is walked to the right, then one step up
+ * moves to the next row shifted one cell to the left. That is a Hamiltonian cycle for any board size.
+ */
+
+inline glm::uvec2 cycleCell(size_t index, unsigned int boardSize) {
+    const auto row {static_cast<unsigned int>(index / boardSize % boardSize)};
+    const auto column {static_cast<unsigned int>(index % boardSize)};
+
+    return {(column + boardSize - row) % boardSize, row};
+}
+
+inline engine::Direction cycleDirection(const glm::uvec2& cell, unsigned int boardSize) {
+    return (cell.x + cell.y) % boardSize == boardSize - 1 ? engine::Direction::Up : engine::Direction::Right;
+}
+
+inline engine::Game cycleGame(unsigned int boardSize, size_t length, unsigned int seed = 1) {
+    const size_t area {static_cast<size_t>(boardSize) * boardSize};
+    if (length < 2 || length >= area) {
+        throw std::runtime_error{"Snake does not fit the board"};
+    }
+
+    engine::Body body {boardSize};
+    for (size_t index = length; index-- > 0;) {
+        body.pushBack(
+            cycleCell(index, boardSize),
+            index % boardSize == 0 ? engine::Direction::Up : engine::Direction::Right
+        );
+    }
+
+    return engine::Game{boardSize, std::move(body), cycleCell((length + area) / 2, boardSize), seed};
+}
+
+inline void cycleMove(engine::Game& game) {
+    game.setNextDirection(cycleDirection(game.body().front().first, game.boardSize()));
+    game.move();
+}
+
+}
@@ -0,0 +1,70 @@
+#include <bench/Bench.hpp>
+#include <bench/Games.hpp>
+#include <bench/Suites.hpp>
+#include <object/Geometry.hpp>
+#include <util/Cube.hpp>
+#include <filesystem>
+
+namespace app::bench {
+
+void geometry() {
+    // the instance matrices the snake uploads every frame
+    for (const size_t length : {16u, 256u, 2048u}) {
+        const auto game {cycleGame(64, length)};
+        std::vector<glm::mat4> instances(length);
+
+        const auto building {measure(256, [&] {
+            doNotOptimize(object::snakeInstances(game.body(), game.skipTailMove(), 0.5f, 0, length, instances));
+            doNotOptimize(instances.back());
+        })};
+        report("board 64, length " + std::to_string(length) + " snake instances", building);
+
+        // the boxes the snake culls against the frustum, 64 segments each
+        const auto bounding {measure(256, [&] {
+            for (size_t first = 0; first < length; first += 64) {
+                doNotOptimize(object::snakeBounds(game.body(), first, 64));
+            }
+        })};
+        report("board 64, length " + std::to_string(length) + " snake bounds", bounding);
+    }
+
+    for (const size_t boardSize : {13u, 64u, 256u}) {
+        const auto generating {measure(boardSize >= 256 ? 4 : 64, [&] {
+            doNotOptimize(object::boardVeboData(boardSize));
+        })};
+        report("board " + std::to_string(boardSize) + " vebo data", generating);
+    }
+
+    // a level with a pillar every 8 cells, every chunk has walls
+    const auto levelPath {std::filesystem::temp_directory_path() / "snake-bench.level"};
+    engine::Bitboard walls {1024};
+    for (unsigned int y = 8; y < 1024; y += 8) {
+        for (unsigned int x = 8; x < 1024; x += 8) {
+            walls.set({x, y});
+        }
+    }
+    engine::Level::write(levelPath, walls, {4, 4});
+
+    const auto opening {measure(64, [&] { doNotOptimize(engine::Level::load(levelPath)); })};
+    report("level 1024 open", opening);
+
+    const auto level {engine::Level::load(levelPath)};
+    // room for the most runs a chunk can have, every other cell a wall
+    std::vector<float> vertices(64 * 32 * 8);
+    std::vector<unsigned int> indices(64 * 32 * 6);
+    size_t chunk {0};
+    const auto building {measure(256, [&] {
+        const glm::uvec2 position {chunk % 16, chunk / 16 % 16};
+        const auto runs {object::wallChunkRuns(*level, position)};
+        object::wallChunkVeboData(*level, position, {vertices.data(), runs * 8}, {indices.data(), runs * 6});
+        doNotOptimize(vertices.data());
+        ++chunk;
+    })};
+    report("level 1024 wall chunk vebo data", building);
+    std::filesystem::remove(levelPath);
+
+    const auto cube {measure(4096, [] { doNotOptimize(util::Cube::indexed()); })};
+    report("cube indexed", cube);
+}
+
+}
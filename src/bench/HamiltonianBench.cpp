@@ -0,0 +1,55 @@
+#include <bench/Bench.hpp>
+#include <bench/Suites.hpp>
+#include <engine/HamiltonianSolver.hpp>
+#include <sstream>
+#include <stdexcept>
+
+namespace app::bench {
+
+void hamiltonian() {
+    const auto cacheDirectory {std::filesystem::temp_directory_path() / "snake-bench-cache"};
+
+    for (const unsigned int boardSize : {16u, 32u, 64u}) {
+        const auto name {"board " + std::to_string(boardSize)};
+
+        std::filesystem::remove(cacheDirectory / ("hamiltonian-" + std::to_string(boardSize) + ".bin"));
+        auto begin {std::chrono::steady_clock::now()};
+        engine::HamiltonianCycle::load(boardSize, cacheDirectory);
+        const std::chrono::duration<double, std::nano> cold {std::chrono::steady_clock::now() - begin};
+
+        const auto cached {measure(20, [&] { doNotOptimize(engine::HamiltonianCycle::load(boardSize, cacheDirectory)); })};
+        report(name + " cycle load", cached, "cold " + std::to_string(static_cast<long long>(cold.count() / 1000)) + " us");
+
+        const engine::HamiltonianSolver solver {engine::HamiltonianCycle::load(boardSize, cacheDirectory)};
+        const engine::Game start {boardSize, 1};
+        report(name + " decide", measure(100000, [&] { doNotOptimize(solver.decide(start)); }));
+
+        // deterministic maximum-length workload: play until the board is full
+        engine::Game game {boardSize, 1};
+        size_t steps {0};
+        auto state {engine::GameState::Running};
+
+        begin = std::chrono::steady_clock::now();
+        while (state == engine::GameState::Running) {
+            game.setNextDirection(solver.decide(game));
+            state = game.move();
+            ++steps;
+        }
+        const std::chrono::duration<double> playing {std::chrono::steady_clock::now() - begin};
+
+        if (state != engine::GameState::Won) {
+            throw std::runtime_error{"Hamiltonian cycle player lost"};
+        }
+
+        const std::chrono::duration<double, std::nano> perStep {playing / steps};
+        std::ostringstream extra {};
+        extra
+            << std::fixed << std::setprecision(0) << steps << " steps to win in "
+            << std::setprecision(2) << playing.count() << " s, "
+            << std::setprecision(0) << 1e9 / perStep.count() << " steps/s";
+
+        report(name + " play to win", {perStep.count(), perStep.count()}, extra.str());
+    }
+}
+
+}
@@ -0,0 +1,76 @@
+#include <bench/Bench.hpp>
+#include <bench/Games.hpp>
+#include <bench/Suites.hpp>
+#include <object/Geometry.hpp>
+#include <util/FrameArena.hpp>
+#include <util/JobSystem.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <array>
+
+namespace app::bench {
+
+namespace {
+
+/// The snake the way frames were prepared before the job system: culled and built run by run on one thread
+size_t sequentialSnake(const engine::Body& body, const util::Frustum& frustum, std::span<glm::mat4> instances) {
+    constexpr size_t runLength {64};
+
+    size_t written {object::snakeInstances(body, false, 0.5f, 0, 1, instances)};
+    for (size_t first = 1; first < body.size(); first += runLength) {
+        const auto [min, max] {object::snakeBounds(body, first, runLength)};
+        if (frustum.intersects(min, max)) {
+            written += object::snakeInstances(body, false, 0.5f, first, runLength, instances.subspan(written));
+        }
+    }
+
+    return written;
+}
+
+}
+
+void jobs() {
+    // the same counts on every machine, results compare; more workers than cores only add switching
+    constexpr std::array<unsigned int, 3> workerCounts {1, 3, 7};
+
+    for (const auto workers : workerCounts) {
+        util::JobSystem jobs {workers};
+
+        const auto empty {measure(4096, [&] {
+            jobs.parallelFor(64, 1, [](size_t begin, size_t end) { doNotOptimize(begin + end); });
+        })};
+        report(std::to_string(workers) + " workers, parallel for of 64 empty pieces", empty);
+    }
+
+    // the camera of the game, and zoomed in 8 times around the board center
+    const auto view {glm::lookAt(glm::vec3(0.0f, -0.6f, 1.1f), glm::vec3(0.0f, -0.07f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f))};
+    const auto projection {glm::perspective(glm::radians(45.0f), 16 / 9.0f, 0.1f, 100.0f)};
+
+    for (const size_t length : {16'384ul, 262'144ul}) {
+        const auto game {cycleGame(1024, length)};
+
+        for (const float zoom : {1.0f, 8.0f}) {
+            const util::Frustum frustum {projection * glm::scale(view, glm::vec3{zoom})};
+            const auto name {"board 1024, length " + std::to_string(length) + (zoom > 1.0f ? ", zoomed" : "")};
+            const auto iterations {length > 100'000 ? 4ul : 64ul};
+
+            std::vector<glm::mat4> instances(length);
+            const auto sequential {measure(iterations, [&] {
+                doNotOptimize(sequentialSnake(game.body(), frustum, instances));
+            })};
+            report(name + " snake in view, one thread", sequential);
+
+            util::FrameArena arena {sizeof(glm::mat4) * length * 2};
+            for (const auto workers : workerCounts) {
+                util::JobSystem jobs {workers};
+
+                const auto parallel {measure(iterations, [&] {
+                    arena.reset();
+                    doNotOptimize(object::visibleSnakeInstances(game.body(), false, 0.5f, frustum, 64, 16, arena, jobs).instances.size());
+                })};
+                report(name + " snake in view, " + std::to_string(workers) + " workers", parallel);
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,70 @@
+#include <bench/Bench.hpp>
+#include <bench/Suites.hpp>
+#include <util/Metrics.hpp>
+#include <atomic>
+#include <sstream>
+#include <thread>
+
+namespace app::bench {
+
+namespace {
+
+util::metrics::Counter benchCounter {"snake_bench_counter_total", "Counter the bench adds to"};
+util::metrics::Histogram benchHistogram {"snake_bench_histogram_seconds", "Histogram the bench observes", {
+    std::chrono::microseconds{10}, std::chrono::microseconds{100}, std::chrono::milliseconds{1}, std::chrono::milliseconds{10}
+}};
+
+/// `threads` threads doing `operation` `iterations` times each at once, ns per operation of one thread
+template<typename Operation>
+Measurement contended(size_t threads, size_t iterations, Operation&& operation) {
+    return measure(1, [&] {
+        std::atomic<size_t> ready {0};
+        std::vector<std::jthread> workers {};
+        for (size_t thread = 0; thread < threads; ++thread) {
+            workers.emplace_back([&] {
+                // start together, the adds overlap
+                ready.fetch_add(1);
+                while (ready.load() < threads) {}
+
+                for (size_t i = 0; i < iterations; ++i) {
+                    operation();
+                }
+            });
+        }
+    }, defaultSamples);
+}
+
+}
+
+void metrics() {
+    constexpr size_t iterations {1'000'000};
+
+    report("counter add", measure(iterations, [] { benchCounter.add(); }));
+    report("histogram observe", measure(iterations, [] { benchHistogram.observe(std::chrono::microseconds{250}); }));
+
+    // what the shards save: every thread on one cache line
+    std::atomic<std::uint64_t> shared {0};
+    const auto threads {std::max(2u, std::min(8u, std::thread::hardware_concurrency()))};
+    const auto label {std::to_string(threads) + " threads"};
+
+    const auto sharded {contended(threads, iterations, [] { benchCounter.add(); })};
+    report("counter add, " + label, {sharded.median / iterations, sharded.min / iterations, sharded.mad / iterations});
+
+    const auto unsharded {contended(threads, iterations, [&shared] { shared.fetch_add(1, std::memory_order_relaxed); })};
+    report("one atomic add, " + label, {unsharded.median / iterations, unsharded.min / iterations, unsharded.mad / iterations});
+
+    const auto observed {contended(threads, iterations, [] { benchHistogram.observe(std::chrono::microseconds{250}); })};
+    report("histogram observe, " + label, {observed.median / iterations, observed.min / iterations, observed.mad / iterations});
+
+    std::ostringstream text {};
+    const auto writing {measure(64, [&text] {
+        text.str({});
+        util::metrics::write(text);
+    })};
+    std::ostringstream extra {};
+    extra << text.str().size() << " bytes";
+    report("write all metrics", writing, extra.str());
+    doNotOptimize(shared.load());
+}
+
+}
@@ -0,0 +1,68 @@
+#include <bench/Bench.hpp>
+#include <bench/Games.hpp>
+#include <bench/Suites.hpp>
+#include <engine/MonteCarloSearch.hpp>
+#include <sstream>
+#include <thread>
+
+namespace app::bench {
+
+void monteCarlo() {
+    using State = engine::MonteCarloSearch::State;
+
+    for (const unsigned int boardSize : {13u, 32u}) {
+        const size_t length {static_cast<size_t>(boardSize) * boardSize / 4};
+        const State state {cycleGame(boardSize, length), 1};
+        const auto name {"board " + std::to_string(boardSize) + ", length " + std::to_string(length)};
+
+        report(name + " clone", measure(1000000, [&] {
+            State clone {state};
+            doNotOptimize(clone);
+        }), std::to_string(sizeof(State)) + " bytes");
+
+        State target {};
+        report(name + " restore", measure(1000000, [&] {
+            target = state;
+            doNotOptimize(target);
+        }));
+    }
+
+    // root-parallel scaling on the same position
+    const State root {cycleGame(13, 40), 1};
+    const auto cores {std::max(1u, std::thread::hardware_concurrency())};
+    std::vector<unsigned int> threadCounts {};
+    for (unsigned int threads = 1; threads < cores; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(cores);
+
+    double singleThreaded {0};
+    for (const auto threads : threadCounts) {
+        engine::MonteCarloSearch search {threads, {.iterations = 4000}};
+        std::vector<double> rates {};
+
+        for (size_t sample = 0; sample <= 7; ++sample) {
+            search.search(root);
+            const auto& statistics {search.statistics()};
+            if (sample > 0) {
+                rates.push_back(static_cast<double>(statistics.rollouts) * 1e9 / static_cast<double>(statistics.elapsed.count()));
+            }
+        }
+        std::sort(rates.begin(), rates.end());
+
+        const auto rate {rates[rates.size() / 2]};
+        if (threads == 1) {
+            singleThreaded = rate;
+        }
+
+        std::ostringstream extra {};
+        extra
+            << std::fixed << std::setprecision(0) << rate << " rollouts/s, "
+            << search.statistics().simulatedMoves / std::max<size_t>(search.statistics().rollouts, 1) << " moves/rollout, "
+            << std::setprecision(2) << rate / singleThreaded << "x";
+
+        report("mcts " + std::to_string(threads) + " threads", {1e9 / rate, 1e9 / rates.back()}, extra.str());
+    }
+}
+
+}
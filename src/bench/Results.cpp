@@ -0,0 +1,114 @@
+#include "Results.hpp"
+#include <fstream>
+#include <stdexcept>
+
+namespace app::bench {
+
+namespace {
+
+std::string quoted(const std::string& text) {
+    std::string result {"\""};
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result + '"';
+}
+
+/// Value of `"key": ...` in a line written by `writeResults`
+std::string field(const std::string& line, const std::string& key) {
+    const auto keyPosition {line.find(quoted(key) + ':')};
+    if (keyPosition == std::string::npos) {
+        throw std::runtime_error{"Missing \"" + key + "\" in benchmark results"};
+    }
+
+    auto position {keyPosition + key.size() + 3};
+    while (position < line.size() && line[position] == ' ') {
+        ++position;
+    }
+
+    if (position < line.size() && line[position] == '"') {
+        std::string value {};
+        for (++position; position < line.size() && line[position] != '"'; ++position) {
+            if (line[position] == '\\') {
+                ++position;
+            }
+            value += line[position];
+        }
+        return value;
+    }
+
+    const auto end {line.find_first_of(",}", position)};
+    return line.substr(position, end - position);
+}
+
+}
+
+void writeResults(const std::filesystem::path& path, const std::vector<Result>& results) {
+    std::ofstream file {path};
+    if (!file) {
+        throw std::runtime_error{"Unable to write " + path.string()};
+    }
+
+    file << std::fixed << std::setprecision(3);
+    for (const auto& [suite, name, measurement] : results) {
+        file
+            << "{\"suite\": " << quoted(suite) << ", \"name\": " << quoted(name)
+            << ", \"median\": " << measurement.median << ", \"mad\": " << measurement.mad
+            << ", \"min\": " << measurement.min << "}\n";
+    }
+}
+
+std::vector<Result> readResults(const std::filesystem::path& path) {
+    std::ifstream file {path};
+    if (!file) {
+        throw std::runtime_error{"Unable to read " + path.string()};
+    }
+
+    std::vector<Result> results {};
+    for (std::string line {}; std::getline(file, line);) {
+        if (line.find('{') == std::string::npos) {
+            continue;
+        }
+        results.push_back({
+            field(line, "suite"),
+            field(line, "name"),
+            {std::stod(field(line, "median")), std::stod(field(line, "min")), std::stod(field(line, "mad"))},
+        });
+    }
+
+    return results;
+}
+
+size_t compareResults(const std::vector<Result>& baseline, const std::vector<Result>& current, double thresholdPercent) {
+    size_t regressions {0};
+
+    for (const auto& result : current) {
+        const auto base {std::find_if(baseline.begin(), baseline.end(), [&](const auto& other) {
+            return other.suite == result.suite && other.name == result.name;
+        })};
+        if (base == baseline.end()) {
+            continue;
+        }
+
+        const auto before {base->measurement}, after {result.measurement};
+        const auto change {(after.median - before.median) / before.median * 100};
+        const bool regressed {
+            change > thresholdPercent && after.median - before.median > 3 * std::max(before.mad, after.mad)
+        };
+        regressions += regressed;
+
+        std::cout
+            << std::left << std::setw(60) << result.suite + ": " + result.name << std::right
+            << std::fixed << std::setprecision(1)
+            << std::setw(12) << before.median << " ->" << std::setw(12) << after.median << " ns/op"
+            << std::showpos << std::setw(9) << change << "%" << std::noshowpos
+            << (regressed ? "  REGRESSION" : "") << std::endl;
+    }
+
+    return regressions;
+}
+
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <bench/Bench.hpp>
+#include <filesystem>
+
+namespace app::bench {
+
+/// One JSON object per line: `{"suite": ..., "name": ..., "median": ..., "mad": ..., "min": ...}`, times in ns
+void writeResults(const std::filesystem::path& path, const std::vector<Result>& results);
+std::vector<Result> readResults(const std::filesystem::path& path);
+
+/**
+ * Prints every case found in both files with its change of median. A case regressed when its median grew
+ * by more than `thresholdPercent` and by more than three MADs of either run, so noisy cases don't flag.
+ * Returns the number of regressions.
+ */
+size_t compareResults(const std::vector<Result>& baseline, const std::vector<Result>& current, double thresholdPercent);
+
+}
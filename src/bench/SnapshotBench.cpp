@@ -0,0 +1,95 @@
+#include <bench/Bench.hpp>
+#include <bench/Games.hpp>
+#include <bench/Suites.hpp>
+#include <server/Snapshot.hpp>
+#include <limits>
+#include <sstream>
+
+namespace app::bench {
+
+namespace {
+
+using Stream = std::vector<std::vector<std::byte>>;
+
+Stream record(engine::Game& game, unsigned int keyframeInterval, size_t steps) {
+    server::SnapshotEncoder encoder {keyframeInterval};
+
+    Stream stream(steps);
+    for (std::uint32_t step = 0; step < steps; ++step) {
+        if (step > 0) {
+            cycleMove(game);
+        }
+        encoder.encode(game, server::SessionStatus::Running, step, stream[step]);
+    }
+
+    return stream;
+}
+
+void decode(server::SnapshotDecoder& decoder, const Stream& stream) {
+    for (const auto& snapshot : stream) {
+        if (!decoder.decode(snapshot)) {
+            throw std::runtime_error{"Snapshot decoding failed"};
+        }
+    }
+}
+
+}
+
+void snapshot() {
+    constexpr unsigned int boardSize {256};
+    constexpr size_t steps {4096};
+    constexpr unsigned int keyframeInterval {64};
+
+    for (const size_t length : {1'024ul, 16'384ul, 60'000ul}) {
+        const std::string name {"length " + std::to_string(length)};
+
+        auto game {cycleGame(boardSize, length)};
+        const auto stream {record(game, keyframeInterval, steps)};
+        auto deltasGame {cycleGame(boardSize, length)};
+        const auto deltas {record(deltasGame, std::numeric_limits<unsigned int>::max(), steps)};
+
+        server::SnapshotDecoder decoder {};
+        decode(decoder, stream);
+        if (decoder.body() != game.body() || decoder.treat() != game.treat()) {
+            throw std::runtime_error{"Decoded body differs"};
+        }
+
+        size_t streamBytes {0};
+        for (const auto& snapshot : stream) {
+            streamBytes += snapshot.size();
+        }
+        std::ostringstream bytes {};
+        bytes
+            << std::fixed << std::setprecision(1) << 1.0 * streamBytes / steps << " B/step with keyframe every " << keyframeInterval
+            << ", " << deltas.back().size() << " B/delta, " << length * 4 << " B/full body";
+
+        std::vector<std::byte> output {};
+        report(name + " keyframe encode", measure(16, [&]{
+            server::SnapshotEncoder encoder {};
+            encoder.encodeKeyframe(game, server::SessionStatus::Running, 0, output);
+            doNotOptimize(output.data());
+        }), bytes.str());
+
+        report(name + " keyframe decode", measure(16, [&]{
+            decoder.decode(stream.front());
+            doNotOptimize(decoder.body().size());
+        }));
+
+        const server::SnapshotEncoder encoded {[&]{
+            server::SnapshotEncoder encoder {};
+            encoder.encode(game, server::SessionStatus::Running, 0, output);
+            cycleMove(game);
+            return encoder;
+        }()};
+        report(name + " delta encode", measure(100'000, [&]{
+            auto encoder {encoded};
+            encoder.encode(game, server::SessionStatus::Running, 1, output);
+            doNotOptimize(output.data());
+        }));
+
+        const auto streamDecode {measure(1, [&]{ decode(decoder, deltas); })};
+        report(name + " delta decode", {streamDecode.median / steps, streamDecode.min / steps});
+    }
+}
+
+}
@@ -0,0 +1,35 @@
+#include <bench/Bench.hpp>
+#include <bench/Suites.hpp>
+#include <object/SpectatorTiles.hpp>
+#include <sstream>
+
+namespace app::bench {
+
+void spectator() {
+    for (const size_t tiles : {16u, 256u, 1024u}) {
+        object::SpectatorTiles wall {tiles, 13};
+        std::vector<object::TileInstance> instances {};
+
+        // let the snakes grow a bit
+        for (size_t i = 0; i < 100; ++i) {
+            wall.step();
+        }
+        const auto name {std::to_string(tiles) + " tiles"};
+
+        report(name + " step", measure(tiles >= 1024 ? 5 : 50, [&] { wall.step(); }));
+
+        const auto packing {measure(200, [&] {
+            wall.pack(instances);
+            doNotOptimize(instances.data());
+        })};
+
+        std::ostringstream extra {};
+        extra
+            << instances.size() << " instances, "
+            << instances.size() * sizeof(object::TileInstance) / 1024 << " KiB upload, 1 draw call, "
+            << wall.grid().x << "x" << wall.grid().y << " grid";
+        report(name + " pack", packing, extra.str());
+    }
+}
+
+}
@@ -0,0 +1,112 @@
+#include <bench/Bench.hpp>
+#include <bench/Games.hpp>
+#include <bench/Suites.hpp>
+#include <engine/StateRing.hpp>
+#include <object/Geometry.hpp>
+#include <atomic>
+#include <optional>
+#include <sstream>
+#include <thread>
+
+namespace app::bench {
+
+namespace {
+
+/**
+ * A publisher thread moves and publishes every `interval`, a reader on its own mapping waits for each new state,
+ * spinning, sleeping `poll` between looks, or without one sleeping until the publish as the game does,
+ * and builds the snake matrices from it in place. Returns the nanoseconds from each publish to the matrices.
+ */
+std::vector<double> publishToRender(
+    unsigned int boardSize, size_t length, std::chrono::microseconds interval, std::optional<std::chrono::microseconds> poll, size_t states
+) {
+    const std::string name {"/snake-bench-" + std::to_string(length)};
+    const auto publisher {engine::StateRing::create(name, boardSize)};
+    const auto reader {engine::StateRing::open(name)};
+
+    std::vector<glm::mat4> instances(static_cast<size_t>(boardSize) * boardSize);
+    std::vector<double> latencies {};
+    std::atomic<size_t> received {0};
+    std::atomic<bool> done {false};
+
+    std::jthread readerThread {[&] {
+        std::uint64_t seen {0};
+        while (latencies.size() < states && !done.load(std::memory_order_relaxed)) {
+            if (!poll.has_value()) {
+                if (!reader->waitPublished(seen, std::chrono::milliseconds{10})) {
+                    continue;
+                }
+            } else if (reader->published() == seen) {
+                if (poll->count() > 0) {
+                    std::this_thread::sleep_for(*poll);
+                }
+                continue;
+            }
+            seen = reader->published();
+
+            engine::StateRing::Clock::time_point publishedAt {};
+            reader->read([&](const engine::StateRing::Snapshot& snapshot) {
+                publishedAt = snapshot.publishedAt();
+                object::snakeInstances(snapshot, snapshot.skipTailMove(), 0.5f, 0, snapshot.size(), instances);
+            });
+            latencies.push_back(std::chrono::duration<double, std::nano>{engine::StateRing::Clock::now() - publishedAt}.count());
+            received.store(latencies.size(), std::memory_order_relaxed);
+        }
+    }};
+
+    auto game {cycleGame(boardSize, length)};
+    const auto camera {glm::mat4{1.0f}};
+    for (size_t state = 0; state < states * 2 && received.load(std::memory_order_relaxed) < states; ++state) {
+        cycleMove(game);
+        publisher->publish(game, camera, engine::StateRing::Clock::now(), interval);
+        std::this_thread::sleep_for(interval);
+    }
+    done = true;
+    readerThread.join();
+
+    return latencies;
+}
+
+}
+
+void stateRing() {
+    constexpr unsigned int boardSize {256};
+
+    for (const size_t length : {16ul, 1'024ul, 16'384ul}) {
+        const std::string name {"board 256, length " + std::to_string(length)};
+        const std::string sharedName {"/snake-bench-ring"};
+
+        const auto publisher {engine::StateRing::create(sharedName, boardSize)};
+        const auto reader {engine::StateRing::open(sharedName)};
+        auto game {cycleGame(boardSize, length)};
+        const auto camera {glm::mat4{1.0f}};
+
+        const auto publishing {measure(64, [&] {
+            cycleMove(game);
+            publisher->publish(game, camera, engine::StateRing::Clock::now(), std::chrono::milliseconds{300});
+        })};
+        report(name + " publish", publishing);
+
+        std::vector<glm::mat4> instances(length + 1);
+        const auto reading {measure(64, [&] {
+            reader->read([&](const engine::StateRing::Snapshot& snapshot) {
+                doNotOptimize(object::snakeInstances(snapshot, snapshot.skipTailMove(), 0.5f, 0, snapshot.size(), instances));
+            });
+        })};
+        report(name + " read in place to matrices", reading);
+
+        // a move every 2 ms, far more often than the game
+        using Poll = std::optional<std::chrono::microseconds>;
+        for (const auto poll : {Poll{0}, Poll{1000}, Poll{}}) {
+            const auto latencies {publishToRender(boardSize, length, std::chrono::microseconds{2000}, poll, 256)};
+
+            const auto mode {!poll ? "reader waiting for the publish" : poll->count() == 0 ? "spinning reader" : "reader polling every 1 ms"};
+            const auto suffix {!poll ? ", waited" : poll->count() == 0 ? "" : ", polled"};
+            std::ostringstream extra {};
+            extra << latencies.size() << " states, " << mode;
+            report(name + " publish to render" + suffix, summarize(latencies), extra.str());
+        }
+    }
+}
+
+}
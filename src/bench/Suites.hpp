@@ -0,0 +1,20 @@
+#pragma once
+
+namespace app::bench {
+
+void autopilot();
+void capture();
+void fixedEngine();
+void environment();
+void game();
+void geometry();
+void hamiltonian();
+void jobs();
+void metrics();
+void monteCarlo();
+void snapshot();
+void spectator();
+void stateRing();
+void timerWheel();
+
+}
@@ -0,0 +1,45 @@
+#include <bench/Bench.hpp>
+#include <bench/Suites.hpp>
+#include <engine/TimerWheel.hpp>
+#include <random>
+
+namespace app::bench {
+
+void timerWheel() {
+    using Clock = engine::TimerWheel::Clock;
+    using namespace std::chrono_literals;
+
+    for (const size_t sessions : {1'000ul, 100'000ul}) {
+        const std::string name {std::to_string(sessions) + " sessions"};
+        const auto start {Clock::now()};
+
+        engine::TimerWheel wheel {100us, start};
+        std::minstd_rand random {1};
+
+        std::vector<engine::TimerWheel::TimerId> timers {};
+        for (size_t i = 0; i < sessions; ++i) {
+            timers.push_back(wheel.add(start + std::chrono::microseconds{random() % 300'000}, i));
+        }
+
+        report(name + " reschedule (boost)", measure(sessions, [&]{
+            wheel.reschedule(timers[random() % sessions], start + std::chrono::microseconds{random() % 300'000});
+        }));
+
+        // every session moves every 100..300 ms, one simulated second of expiries per sample
+        constexpr size_t samples {7};
+        auto now {start};
+        size_t fired {0};
+        const auto second {measure(1, [&]{
+            for (const auto end {now + 1s}; now < end; now += 1ms) {
+                wheel.expire(now, [&](auto id, auto) {
+                    ++fired;
+                    wheel.reschedule(id, now + std::chrono::milliseconds{100 + random() % 200});
+                });
+            }
+        }, samples)};
+        const double perExpiry {second.median * (samples + 1) / fired}; // + warm-up
+        report(name + " expire + reschedule", {perExpiry, perExpiry * second.min / second.median});
+    }
+}
+
+}
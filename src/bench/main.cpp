@@ -0,0 +1,84 @@
+#include <bench/Results.hpp>
+#include <bench/Suites.hpp>
+#include <array>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+    constexpr std::array<std::pair<std::string_view, void(*)()>, 14> suites {{
+        {"autopilot", app::bench::autopilot},
+        {"capture", app::bench::capture},
+        {"engine", app::bench::fixedEngine},
+        {"env", app::bench::environment},
+        {"game", app::bench::game},
+        {"geometry", app::bench::geometry},
+        {"hamiltonian", app::bench::hamiltonian},
+        {"jobs", app::bench::jobs},
+        {"mcts", app::bench::monteCarlo},
+        {"metrics", app::bench::metrics},
+        {"snapshot", app::bench::snapshot},
+        {"spectator", app::bench::spectator},
+        {"state-ring", app::bench::stateRing},
+        {"timer-wheel", app::bench::timerWheel},
+    }};
+
+    std::vector<std::string> selected {};
+    std::string jsonPath {};
+    std::vector<std::string> comparePaths {};
+    double threshold {5};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option {argv[i]};
+
+        if (!option.starts_with("--")) {
+            selected.push_back(option);
+            continue;
+        }
+        const int values {option == "--compare" ? 2 : 1};
+        if (i + values >= argc) {
+            std::cerr << "Missing value for " << option << std::endl;
+            return 1;
+        }
+
+        if (option == "--json") {
+            jsonPath = argv[++i];
+        } else if (option == "--repeats") {
+            app::bench::defaultSamples = std::max(1ul, std::stoul(argv[++i]));
+        } else if (option == "--threshold") {
+            threshold = std::stod(argv[++i]);
+        } else if (option == "--compare") {
+            comparePaths = {argv[i + 1], argv[i + 2]};
+            i += 2;
+        } else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+
+    if (!comparePaths.empty()) {
+        const auto regressions {app::bench::compareResults(
+            app::bench::readResults(comparePaths[0]), app::bench::readResults(comparePaths[1]), threshold
+        )};
+        std::cout << regressions << " regressions over " << threshold << "%" << std::endl;
+
+        return regressions > 0 ? 1 : 0;
+    }
+
+    for (const auto& [name, suite] : suites) {
+        if (selected.empty() || std::find(selected.begin(), selected.end(), name) != selected.end()) {
+            std::cout << "# " << name << std::endl;
+            app::bench::currentSuite = name;
+            suite();
+        }
+    }
+
+    if (!jsonPath.empty()) {
+        app::bench::writeResults(jsonPath, app::bench::results);
+    }
+
+    return 0;
+}
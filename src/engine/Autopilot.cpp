@@ -0,0 +1,342 @@
+#include "Autopilot.hpp"
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace app::engine {
+
+namespace {
+
+constexpr std::array<Direction, 4> directions {Direction::Up, Direction::Down, Direction::Left, Direction::Right};
+
+}
+
+//region Constructor & Destructor
+
+Autopilot::Autopilot(unsigned int boardSize)
+    : mBoardSize{boardSize}
+    , mBody{boardSize}
+    , mFree{boardSize}
+    , mReached{boardSize}
+    , mFrontier{boardSize}
+    , mNext{boardSize}
+    , mTreats{boardSize}
+    , mDistance(static_cast<size_t>(boardSize) * boardSize, unreachable)
+{}
+
+//endregion
+
+//region Public Methods
+
+Direction Autopilot::decide(const Game& game) {
+    sync(game);
+
+    const auto& body {game.body()};
+    const auto head {body.front().first};
+    const auto tail {body.back().first};
+
+    struct Candidate {
+        Direction direction;
+        glm::uvec2 cell;
+        bool tailMoves;
+        std::uint32_t distance;
+        size_t area {0}; // of the pocket, once the tail is out of reach
+    };
+    std::array<Candidate, 4> candidates {};
+    size_t count {0};
+
+    for (const auto direction : directions) {
+        if (isOpposite(direction, game.direction())) {
+            continue;
+        }
+
+        const auto next {moveCell(head, direction, mBoardSize)};
+        // only the move after eating keeps the tail in place, eating again included
+        const bool tailMoves {!game.skipTailMove()};
+
+        if (mBody.test(next) && !(tailMoves && next == tail)) {
+            continue;
+        }
+
+        candidates[count++] = {direction, next, tailMoves, mDistance[index(next)], 0};
+    }
+
+    if (count == 0) {
+        return game.direction();
+    }
+
+    // insertion sort, at most 3 candidates
+    for (size_t i = 1; i < count; ++i) {
+        for (size_t j = i; j > 0 && candidates[j].distance < candidates[j - 1].distance; --j) {
+            std::swap(candidates[j], candidates[j - 1]);
+        }
+    }
+
+    // one flood per candidate, it measures the pocket when it misses the tail
+    for (size_t i = 0; i < count; ++i) {
+        if (isTailReachable(game, candidates[i].cell, candidates[i].tailMoves)) {
+            return candidates[i].direction;
+        }
+        candidates[i].area = mReached.count();
+    }
+
+    // trapped, stall in the biggest pocket
+    const auto roomiest {std::max_element(candidates.begin(), candidates.begin() + count, [](const auto& a, const auto& b){
+        return a.area < b.area;
+    })};
+
+    return roomiest->direction;
+}
+
+//endregion
+
+//region Private Methods
+
+void Autopilot::sync(const Game& game) {
+    const auto& body {game.body()};
+
+    if (
+        !mSynced
+        || game.boardSize() != mBoardSize
+        || body.size() < 2 || body[1].first != mHead
+        || body.size() > mLength + 1 || body.size() < mLength
+    ) {
+        return rebuild(game);
+    }
+
+    const auto head {body.front().first};
+    const bool tailPopped {body.size() == mLength};
+    // eating one replaces it somewhere else
+    const bool treatChanged {mTreats.test(head) || game.treat() != mTreat || game.treats().size() != mTreatCount};
+
+    // the head may take the cell the tail has just left
+    if (tailPopped) {
+        mBody.reset(mTail);
+    }
+    mBody.set(head);
+
+    if (treatChanged) {
+        computeDistances(game);
+    } else {
+        blockCell(head);
+        if (tailPopped) {
+            freeCell(mTail);
+        }
+    }
+
+    mHead = head;
+    mTail = body.back().first;
+    mLength = body.size();
+}
+
+void Autopilot::rebuild(const Game& game) {
+    mBody.clear();
+    for (const auto& [cell, direction] : game.body()) {
+        mBody.set(cell);
+    }
+    // walls never move, to the search they are body that stays
+    if (const auto& level {game.level()}) {
+        mBody.merge(level->words());
+    }
+
+    mSynced = true;
+    mHead = game.body().front().first;
+    mTail = game.body().back().first;
+    mLength = game.body().size();
+
+    computeDistances(game);
+}
+
+void Autopilot::computeDistances(const Game& game) {
+    std::fill(mDistance.begin(), mDistance.end(), unreachable);
+
+    mTreat = game.treat();
+    mTreatCount = game.treats().size();
+    mTreats.clear();
+    for (const auto& treat : game.treats().treats()) {
+        mTreats.set(treat.cell);
+    }
+
+    mFree.fill();
+    mFree.subtract(mBody);
+
+    // every free treat is a source, with more than one the layers start on any row
+    mReached.clear();
+    mFrontier.clear();
+    mNext.clear();
+    size_t sources {0};
+    unsigned int sourceRow {0};
+    for (const auto& treat : game.treats().treats()) {
+        if (mFree.test(treat.cell)) {
+            mDistance[index(treat.cell)] = 0;
+            mReached.set(treat.cell);
+            mFrontier.set(treat.cell);
+            sourceRow = treat.cell.y;
+            ++sources;
+        }
+    }
+    if (sources == 0) {
+        return;
+    }
+
+    expand(sources == 1 ? sourceRow : 0, sources == 1 ? 1 : mBoardSize, [this](std::uint32_t distance, const Bitboard& layer, unsigned int firstRow, unsigned int rows){
+        layer.forEach([this, distance](const glm::uvec2& cell){ mDistance[index(cell)] = distance; }, firstRow, rows);
+        return true;
+    });
+}
+
+void Autopilot::blockCell(const glm::uvec2& blocked) {
+    const auto blockedDistance {std::exchange(mDistance[index(blocked)], unreachable)};
+    if (blockedDistance == unreachable) {
+        return;
+    }
+
+    // find the cells that lost their only shorter neighbour, layer by layer
+    mAffected.clear();
+    mQueue.clear();
+    for (const auto direction : directions) {
+        const auto neighbour {moveCell(blocked, direction, mBoardSize)};
+        if (mDistance[index(neighbour)] == blockedDistance + 1) {
+            mQueue.push_back(index(neighbour));
+        }
+    }
+
+    for (size_t i = 0; i < mQueue.size(); ++i) {
+        const auto current {mQueue[i]};
+        const auto distance {mDistance[current]};
+        if (distance == unreachable) {
+            continue; // queued twice
+        }
+
+        if (closestNeighbourDistance(cell(current)) + 1 == distance) {
+            continue; // still supported
+        }
+
+        mDistance[current] = unreachable;
+        mAffected.push_back(current);
+
+        for (const auto direction : directions) {
+            const auto neighbour {index(moveCell(cell(current), direction, mBoardSize))};
+            if (mDistance[neighbour] == distance + 1) {
+                mQueue.push_back(neighbour);
+            }
+        }
+    }
+
+    // settle them again from the unaffected border
+    mQueue.clear();
+    for (const auto affected : mAffected) {
+        if (const auto closest {closestNeighbourDistance(cell(affected))}; closest != unreachable) {
+            mDistance[affected] = closest + 1;
+            mQueue.push_back(affected);
+        }
+    }
+    relax();
+}
+
+void Autopilot::freeCell(const glm::uvec2& freed) {
+    if (mBody.test(freed)) {
+        return;
+    }
+
+    if (mTreats.test(freed)) {
+        mDistance[index(freed)] = 0;
+    } else if (const auto closest {closestNeighbourDistance(freed)}; closest != unreachable) {
+        mDistance[index(freed)] = closest + 1;
+    } else {
+        return;
+    }
+
+    mQueue.clear();
+    mQueue.push_back(index(freed));
+    relax();
+}
+
+void Autopilot::relax() {
+    for (size_t i = 0; i < mQueue.size(); ++i) {
+        const auto current {mQueue[i]};
+        const auto distance {mDistance[current] + 1};
+
+        for (const auto direction : directions) {
+            const auto neighbour {moveCell(cell(current), direction, mBoardSize)};
+            const auto neighbourIndex {index(neighbour)};
+
+            if (distance < mDistance[neighbourIndex] && !mBody.test(neighbour)) {
+                mDistance[neighbourIndex] = distance;
+                mQueue.push_back(neighbourIndex);
+            }
+        }
+    }
+}
+
+std::uint32_t Autopilot::closestNeighbourDistance(const glm::uvec2& from) const {
+    std::uint32_t closest {unreachable};
+    for (const auto direction : directions) {
+        closest = std::min(closest, mDistance[index(moveCell(from, direction, mBoardSize))]);
+    }
+    return closest;
+}
+
+bool Autopilot::isTailReachable(const Game& game, const glm::uvec2& nextHead, bool tailMoves) {
+    const auto& body {game.body()};
+    const auto nextTail {tailMoves ? body[body.size() - 2].first : body.back().first};
+
+    occupy(game, nextHead, tailMoves);
+    mFree.set(nextTail);
+
+    bool reachable {nextHead == nextTail};
+    if (!reachable) {
+        flood(nextHead, [&](auto, auto&, auto, auto){
+            reachable = mReached.test(nextTail);
+            return !reachable;
+        });
+    }
+
+    return reachable;
+}
+
+void Autopilot::occupy(const Game& game, const glm::uvec2& nextHead, bool tailMoves) {
+    mFree.fill();
+    mFree.subtract(mBody);
+    mFree.reset(nextHead);
+    if (tailMoves) {
+        mFree.set(game.body().back().first);
+    }
+}
+
+template<typename Visit>
+void Autopilot::flood(const glm::uvec2& from, Visit&& visit) {
+    mReached.clear();
+    mFrontier.clear();
+    mNext.clear();
+    mReached.set(from);
+    mFrontier.set(from);
+
+    expand(from.y, 1, visit);
+}
+
+template<typename Visit>
+void Autopilot::expand(unsigned int firstRow, unsigned int rows, Visit&& visit) {
+    // rows that may hold frontier bits, the next layer can only reach one row further on each side
+    for (std::uint32_t distance = 1;; ++distance) {
+        const unsigned int nextFirstRow {rows >= mBoardSize ? 0 : (firstRow + mBoardSize - 1) % mBoardSize};
+        const unsigned int nextRows {std::min(rows + 2, mBoardSize)};
+
+        if (!mFrontier.expand(mFree, mReached, mNext, nextFirstRow, nextRows)) {
+            break;
+        }
+        mFrontier.clearRows(firstRow, rows);
+        std::swap(mFrontier, mNext);
+
+        firstRow = nextFirstRow;
+        rows = nextRows;
+
+        if (!visit(distance, mFrontier, firstRow, rows)) {
+            break;
+        }
+    }
+}
+
+//endregion
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <engine/Bitboard.hpp>
+#include <engine/Game.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace app::engine {
+
+/**
+ * Bot that picks the next direction of a `Game`: the free neighbour closest to a treat,
+ * as long as the tail stays reachable from the new head, otherwise the one with the most room.
+ *
+ * The distance field to the nearest treat is built with bitboard BFS from all treats at once and then kept up to date
+ * between moves: only the cells whose shortest path went through the new head or can go through the freed tail are touched.
+ */
+class Autopilot {
+public:
+    explicit Autopilot(unsigned int boardSize);
+
+    Autopilot(Autopilot &&other) noexcept = default;
+    Autopilot & operator=(Autopilot &&other) noexcept = default;
+    ~Autopilot() noexcept = default;
+
+    Direction decide(const Game& game);
+    /// Forget the tracked game, the next decision starts from scratch
+    inline void reset() {
+        mSynced = false;
+    }
+
+    inline std::uint32_t distance(const glm::uvec2& cell) const {
+        return mDistance[index(cell)];
+    }
+
+    static constexpr std::uint32_t unreachable {std::numeric_limits<std::uint32_t>::max()};
+
+private:
+    void sync(const Game& game);
+    void rebuild(const Game& game);
+    void computeDistances(const Game& game);
+    void blockCell(const glm::uvec2& cell);
+    void freeCell(const glm::uvec2& cell);
+    void relax();
+    std::uint32_t closestNeighbourDistance(const glm::uvec2& cell) const;
+
+    /// When false the flood ran to the end, `mReached` holds the whole pocket the head would be in
+    bool isTailReachable(const Game& game, const glm::uvec2& nextHead, bool tailMoves);
+    void occupy(const Game& game, const glm::uvec2& nextHead, bool tailMoves);
+
+    /// BFS layers from `from` over `mFree`, calls `visit(distance, layer, firstRow, rows)` until it returns false
+    template<typename Visit>
+    void flood(const glm::uvec2& from, Visit&& visit);
+    /// The same from the cells already in `mFrontier` and `mReached`, all in rows `[firstRow, firstRow + rows)`
+    template<typename Visit>
+    void expand(unsigned int firstRow, unsigned int rows, Visit&& visit);
+
+    inline size_t index(const glm::uvec2& cell) const {
+        return static_cast<size_t>(cell.y) * mBoardSize + cell.x;
+    }
+    inline glm::uvec2 cell(size_t index) const {
+        return {index % mBoardSize, index / mBoardSize};
+    }
+
+private:
+    unsigned int mBoardSize;
+
+    Bitboard mBody;
+    Bitboard mFree;
+    Bitboard mReached;
+    Bitboard mFrontier;
+    Bitboard mNext;
+    Bitboard mTreats;
+
+    std::vector<std::uint32_t> mDistance;
+    std::vector<std::uint32_t> mQueue;
+    std::vector<std::uint32_t> mAffected;
+
+    bool mSynced {false};
+    glm::uvec2 mHead {};
+    glm::uvec2 mTail {};
+    // the first treat and the count tell a treat placed without a move
+    glm::uvec2 mTreat {};
+    size_t mTreatCount {0};
+    size_t mLength {0};
+};
+
+}
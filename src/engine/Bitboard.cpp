@@ -0,0 +1,153 @@
+#include "Bitboard.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace app::engine {
+
+//region Constructor & Destructor
+
+Bitboard::Bitboard(unsigned int size)
+    : mSize{size}
+    , mWordsPerRow{(size + 63) / 64}
+    , mLastWordMask{size % 64 == 0 ? ~std::uint64_t{0} : (std::uint64_t{1} << (size % 64)) - 1}
+    , mWords(static_cast<size_t>(size) * mWordsPerRow)
+    , mScratch(mWordsPerRow * 2)
+{}
+
+//endregion
+
+//region Public Methods
+
+void Bitboard::clear() {
+    std::fill(mWords.begin(), mWords.end(), 0);
+}
+
+void Bitboard::fill() {
+    for (unsigned int y = 0; y < mSize; ++y) {
+        const auto words {mWords.data() + static_cast<size_t>(y) * mWordsPerRow};
+        std::fill(words, words + mWordsPerRow, ~std::uint64_t{0});
+        words[mWordsPerRow - 1] = mLastWordMask;
+    }
+}
+
+bool Bitboard::any() const {
+    return std::any_of(mWords.begin(), mWords.end(), [](std::uint64_t word){ return word != 0; });
+}
+
+size_t Bitboard::count() const {
+    return std::accumulate(mWords.begin(), mWords.end(), size_t{0}, [](size_t sum, std::uint64_t word){
+        return sum + std::popcount(word);
+    });
+}
+
+bool Bitboard::intersects(const Bitboard& other) const {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        if (mWords[i] & other.mWords[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Bitboard& Bitboard::operator&=(const Bitboard& other) {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        mWords[i] &= other.mWords[i];
+    }
+    return *this;
+}
+
+Bitboard& Bitboard::operator|=(const Bitboard& other) {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        mWords[i] |= other.mWords[i];
+    }
+    return *this;
+}
+
+Bitboard& Bitboard::merge(std::span<const std::uint64_t> words) {
+    for (size_t i = 0; i < mWords.size() && i < words.size(); ++i) {
+        mWords[i] |= words[i];
+    }
+    return *this;
+}
+
+Bitboard& Bitboard::subtract(const Bitboard& other) {
+    for (size_t i = 0; i < mWords.size(); ++i) {
+        mWords[i] &= ~other.mWords[i];
+    }
+    return *this;
+}
+
+bool Bitboard::expand(
+    const Bitboard& free, Bitboard& reached, Bitboard& next, unsigned int firstRow, unsigned int rows
+) const {
+    rows = std::min(rows, mSize);
+
+    const auto right {mScratch.data()};
+    const auto left {mScratch.data() + mWordsPerRow};
+
+    std::uint64_t any {0};
+    for (unsigned int i = 0; i < rows; ++i) {
+        const unsigned int y {(firstRow + i) % mSize};
+        const auto current {row(y)};
+        const auto above {row((y + 1) % mSize)};
+        const auto below {row((y + mSize - 1) % mSize)};
+
+        shiftRowRight(current, right);
+        shiftRowLeft(current, left);
+
+        const auto freeRow {free.row(y)};
+        const auto reachedRow {reached.mWords.data() + static_cast<size_t>(y) * mWordsPerRow};
+        const auto nextRow {next.mWords.data() + static_cast<size_t>(y) * mWordsPerRow};
+        for (unsigned int w = 0; w < mWordsPerRow; ++w) {
+            const auto word {(right[w] | left[w] | above[w] | below[w]) & freeRow[w] & ~reachedRow[w]};
+            nextRow[w] = word;
+            reachedRow[w] |= word;
+            any |= word;
+        }
+    }
+
+    return any != 0;
+}
+
+void Bitboard::clearRows(unsigned int firstRow, unsigned int rows) {
+    rows = std::min(rows, mSize);
+
+    for (unsigned int i = 0; i < rows; ++i) {
+        const auto words {mWords.data() + static_cast<size_t>((firstRow + i) % mSize) * mWordsPerRow};
+        std::fill(words, words + mWordsPerRow, 0);
+    }
+}
+
+//endregion
+
+//region Private Methods
+
+// x + 1, the last column wraps to the first one
+void Bitboard::shiftRowRight(const std::uint64_t* source, std::uint64_t* target) const {
+    const unsigned int lastBit {(mSize - 1) % 64};
+    const std::uint64_t wrapped {(source[mWordsPerRow - 1] >> lastBit) & 1};
+
+    std::uint64_t carry {wrapped};
+    for (unsigned int w = 0; w < mWordsPerRow; ++w) {
+        const auto word {source[w]};
+        target[w] = (word << 1) | carry;
+        carry = word >> 63;
+    }
+    target[mWordsPerRow - 1] &= mLastWordMask;
+}
+
+// x - 1, the first column wraps to the last one
+void Bitboard::shiftRowLeft(const std::uint64_t* source, std::uint64_t* target) const {
+    const std::uint64_t wrapped {source[0] & 1};
+
+    for (unsigned int w = 0; w < mWordsPerRow; ++w) {
+        const std::uint64_t next {w + 1 < mWordsPerRow ? source[w + 1] : 0};
+        target[w] = (source[w] >> 1) | (next << 63);
+    }
+    target[mWordsPerRow - 1] |= wrapped << ((mSize - 1) % 64);
+    target[mWordsPerRow - 1] &= mLastWordMask;
+}
+
+//endregion
+
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <glm/vec2.hpp>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace app::engine {
+
+/**
+ * One bit per cell of a wrapping square board, row by row, every row padded to whole 64-bit words.
+ * Shifts wrap around like `Game::getNextHead()`, so BFS frontiers expand with a few word operations per row.
+ */
+class Bitboard {
+public:
+    explicit Bitboard(unsigned int size);
+
+    inline unsigned int size() const {
+        return mSize;
+    }
+
+    inline bool test(const glm::uvec2& cell) const {
+        return (mWords[index(cell)] >> (cell.x % 64)) & 1;
+    }
+    inline void set(const glm::uvec2& cell) {
+        mWords[index(cell)] |= std::uint64_t{1} << (cell.x % 64);
+    }
+    inline void reset(const glm::uvec2& cell) {
+        mWords[index(cell)] &= ~(std::uint64_t{1} << (cell.x % 64));
+    }
+
+    void clear();
+    void fill();
+    bool any() const;
+    size_t count() const;
+    bool intersects(const Bitboard& other) const;
+
+    Bitboard& operator&=(const Bitboard& other);
+    Bitboard& operator|=(const Bitboard& other);
+    /// `this &= ~other`
+    Bitboard& subtract(const Bitboard& other);
+    /// `this |= words`, rows laid out like this board, e.g. the walls of a `Level`
+    Bitboard& merge(std::span<const std::uint64_t> words);
+
+    /**
+     * One BFS layer with this board as the frontier: `next = neighbours & free & ~reached`, then `reached |= next`.
+     * Only rows `[firstRow, firstRow + rows)` (wrapping) are computed, the frontier must be empty outside of them
+     * shrunk by one row on each side. Returns false when `next` is empty.
+     */
+    bool expand(const Bitboard& free, Bitboard& reached, Bitboard& next, unsigned int firstRow, unsigned int rows) const;
+    void clearRows(unsigned int firstRow, unsigned int rows);
+
+    /// Calls `callback(cell)` for every set cell, optionally only in rows `[firstRow, firstRow + rows)` (wrapping)
+    template<typename Callback>
+    void forEach(Callback&& callback, unsigned int firstRow = 0, unsigned int rows = ~0u) const;
+
+    inline unsigned int wordsPerRow() const {
+        return mWordsPerRow;
+    }
+    inline const std::uint64_t* row(unsigned int y) const {
+        return mWords.data() + static_cast<size_t>(y) * mWordsPerRow;
+    }
+
+private:
+    inline size_t index(const glm::uvec2& cell) const {
+        return static_cast<size_t>(cell.y) * mWordsPerRow + cell.x / 64;
+    }
+    void shiftRowRight(const std::uint64_t* source, std::uint64_t* target) const;
+    void shiftRowLeft(const std::uint64_t* source, std::uint64_t* target) const;
+
+private:
+    unsigned int mSize;
+    unsigned int mWordsPerRow;
+    std::uint64_t mLastWordMask;
+    std::vector<std::uint64_t> mWords;
+    mutable std::vector<std::uint64_t> mScratch; // one row
+};
+
+template<typename Callback>
+void Bitboard::forEach(Callback&& callback, unsigned int firstRow, unsigned int rows) const {
+    rows = rows < mSize ? rows : mSize;
+
+    for (unsigned int i = 0; i < rows; ++i) {
+        const unsigned int y {(firstRow + i) % mSize};
+        const auto words {row(y)};
+        for (unsigned int w = 0; w < mWordsPerRow; ++w) {
+            for (auto bits {words[w]}; bits != 0; bits &= bits - 1) {
+                callback(glm::uvec2{w * 64 + std::countr_zero(bits), y});
+            }
+        }
+    }
+}
+
+}
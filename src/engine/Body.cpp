@@ -0,0 +1,86 @@
+#include "Body.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace app::engine {
+
+namespace {
+
+constexpr size_t preallocatedSegments {1 << 20};
+
+}
+
+//region Constructor & Destructor
+
+Body::Body(unsigned int boardSize) {
+    reset(boardSize);
+}
+
+//endregion
+
+//region Public Methods
+
+void Body::reset(unsigned int boardSize) {
+    if (boardSize == mBoardSize) {
+        clear();
+        return;
+    }
+    mFront = 0;
+    mSize = 0;
+
+    const size_t area {static_cast<size_t>(boardSize) * boardSize};
+    const size_t capacity {std::bit_ceil(std::clamp<size_t>(area, 1, preallocatedSegments))};
+
+    mBoardSize = boardSize;
+    mWide = area > 0x10000;
+    mMask = capacity - 1;
+
+    // only one of them holds the cells
+    mNarrowCells.assign(mWide ? 0 : capacity, 0);
+    mNarrowCells.shrink_to_fit();
+    mWideCells.assign(mWide ? capacity : 0, 0);
+    mWideCells.shrink_to_fit();
+    mDirections.assign((capacity + 31) / 32, 0);
+    mOccupied = Bitboard{boardSize};
+}
+
+void Body::clear() {
+    // bit by bit, a short body on a large board costs what it is long
+    for (size_t i = 0; i < mSize; ++i) {
+        mOccupied.reset(cell(i));
+    }
+    mFront = 0;
+    mSize = 0;
+}
+
+void Body::grow() {
+    const size_t capacity {(mMask + 1) * 2};
+
+    // unwrapped, the front moves to the start
+    std::vector<std::uint16_t> narrowCells(mWide ? 0 : capacity);
+    std::vector<std::uint32_t> wideCells(mWide ? capacity : 0);
+    std::vector<std::uint64_t> directions((capacity + 31) / 32);
+    for (size_t i = 0; i < mSize; ++i) {
+        const auto position {(mFront + i) & mMask};
+        if (mWide) {
+            wideCells[i] = mWideCells[position];
+        } else {
+            narrowCells[i] = mNarrowCells[position];
+        }
+        directions[i / 32] |= static_cast<std::uint64_t>(direction(i)) << (i % 32 * 2);
+    }
+
+    mNarrowCells = std::move(narrowCells);
+    mWideCells = std::move(wideCells);
+    mDirections = std::move(directions);
+    mFront = 0;
+    mMask = capacity - 1;
+}
+
+bool Body::operator==(const Body& other) const {
+    return mBoardSize == other.mBoardSize && std::equal(begin(), end(), other.begin(), other.end());
+}
+
+//endregion
+
+}
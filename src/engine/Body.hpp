@@ -0,0 +1,180 @@
+#pragma once
+
+#include <engine/Bitboard.hpp>
+#include <engine/Direction.hpp>
+#include <glm/vec2.hpp>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace app::engine {
+
+/**
+ * Snake segments from the head to the tail in a ring buffer preallocated for the whole board up to 1024x1024,
+ * so moving never allocates there. Larger boards start with that much and double when the snake outgrows it.
+ * A segment is its cell index, 16 bits up to 256x256 boards and 32 bits above, plus the direction it was
+ * entered with as a 2-bit code in a side array. A bit per cell of the board marks the occupied ones,
+ * so the cells of a body are distinct, as they are in a game.
+ */
+class Body {
+public:
+    using Segment = std::pair<glm::uvec2, Direction>;
+
+    class Iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = Segment;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+        Iterator(const Body* body, size_t index) : mBody{body}, mIndex{index} {}
+
+        inline Segment operator*() const {
+            return (*mBody)[mIndex];
+        }
+        inline Segment operator[](difference_type offset) const {
+            return (*mBody)[mIndex + offset];
+        }
+
+        inline Iterator& operator++() { ++mIndex; return *this; }
+        inline Iterator operator++(int) { auto copy {*this}; ++mIndex; return copy; }
+        inline Iterator& operator--() { --mIndex; return *this; }
+        inline Iterator operator--(int) { auto copy {*this}; --mIndex; return copy; }
+        inline Iterator& operator+=(difference_type offset) { mIndex += offset; return *this; }
+        inline Iterator& operator-=(difference_type offset) { mIndex -= offset; return *this; }
+
+        inline friend Iterator operator+(Iterator it, difference_type offset) { return it += offset; }
+        inline friend Iterator operator+(difference_type offset, Iterator it) { return it += offset; }
+        inline friend Iterator operator-(Iterator it, difference_type offset) { return it -= offset; }
+        inline friend difference_type operator-(const Iterator& a, const Iterator& b) {
+            return static_cast<difference_type>(a.mIndex) - static_cast<difference_type>(b.mIndex);
+        }
+        inline friend bool operator==(const Iterator& a, const Iterator& b) { return a.mIndex == b.mIndex; }
+        inline friend auto operator<=>(const Iterator& a, const Iterator& b) { return a.mIndex <=> b.mIndex; }
+
+    private:
+        const Body* mBody {nullptr};
+        size_t mIndex {0};
+    };
+
+    Body() = default;
+    explicit Body(unsigned int boardSize);
+
+    Body(Body &&other) noexcept = default;
+    Body & operator=(Body &&other) noexcept = default;
+    Body(const Body& other) = default;
+    Body & operator=(const Body& other) = default;
+    ~Body() noexcept = default;
+
+    /// Empties the body, storage is allocated again only for another board size
+    void reset(unsigned int boardSize);
+    void clear();
+
+    inline void pushFront(const glm::uvec2& cell, Direction direction) {
+        if (mSize > mMask) {
+            grow();
+        }
+        mFront = (mFront - 1) & mMask;
+        ++mSize;
+        store(mFront, cell, direction);
+    }
+    inline void pushBack(const glm::uvec2& cell, Direction direction) {
+        if (mSize > mMask) {
+            grow();
+        }
+        store((mFront + mSize) & mMask, cell, direction);
+        ++mSize;
+    }
+    inline void popBack() {
+        --mSize;
+        mOccupied.reset(cellAt((mFront + mSize) & mMask));
+    }
+
+    inline size_t size() const {
+        return mSize;
+    }
+    inline bool empty() const {
+        return mSize == 0;
+    }
+    /// Segments that fit, the board area
+    inline size_t capacity() const {
+        return static_cast<size_t>(mBoardSize) * mBoardSize;
+    }
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+
+    inline glm::uvec2 cell(size_t index) const {
+        return cellAt((mFront + index) & mMask);
+    }
+    inline Direction direction(size_t index) const {
+        const auto position {(mFront + index) & mMask};
+        return static_cast<Direction>((mDirections[position / 32] >> (position % 32 * 2)) & 3);
+    }
+    inline Segment operator[](size_t index) const {
+        return {cell(index), direction(index)};
+    }
+    inline Segment front() const {
+        return (*this)[0];
+    }
+    inline Segment back() const {
+        return (*this)[mSize - 1];
+    }
+
+    inline Iterator begin() const {
+        return {this, 0};
+    }
+    inline Iterator end() const {
+        return {this, mSize};
+    }
+
+    inline bool contains(const glm::uvec2& cell) const {
+        return mOccupied.test(cell);
+    }
+    /// The cells of the body in `Bitboard` layout
+    inline const Bitboard& occupancy() const {
+        return mOccupied;
+    }
+
+    bool operator==(const Body& other) const;
+
+private:
+    void grow();
+
+    inline std::uint32_t packedCell(size_t position) const {
+        return mWide ? mWideCells[position] : mNarrowCells[position];
+    }
+    inline glm::uvec2 cellAt(size_t position) const {
+        const auto packed {packedCell(position)};
+        return {packed % mBoardSize, packed / mBoardSize};
+    }
+    inline void store(size_t position, const glm::uvec2& cell, Direction direction) {
+        const auto packed {cell.y * mBoardSize + cell.x};
+        if (mWide) {
+            mWideCells[position] = packed;
+        } else {
+            mNarrowCells[position] = static_cast<std::uint16_t>(packed);
+        }
+
+        auto& word {mDirections[position / 32]};
+        const auto shift {position % 32 * 2};
+        word = (word & ~(std::uint64_t{3} << shift)) | (static_cast<std::uint64_t>(direction) << shift);
+
+        mOccupied.set(cell);
+    }
+
+private:
+    unsigned int mBoardSize {0};
+    bool mWide {false};
+    size_t mMask {0};
+    size_t mFront {0};
+    size_t mSize {0};
+
+    std::vector<std::uint16_t> mNarrowCells;
+    std::vector<std::uint32_t> mWideCells;
+    std::vector<std::uint64_t> mDirections;
+    Bitboard mOccupied {0};
+};
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <engine/RingGame.hpp>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace app::engine {
+
+/// Storage of a `CompactGame`: any square board up to `MaxBoardSize`, sized at run time
+template<unsigned int MaxBoardSize>
+class RuntimeBoard {
+public:
+    static constexpr unsigned int maxBoardSize {MaxBoardSize};
+    static constexpr size_t maxArea {static_cast<size_t>(MaxBoardSize) * MaxBoardSize};
+    static constexpr size_t capacity {std::bit_ceil(maxArea)};
+
+    using Cell = std::conditional_t<(maxArea <= 0x10000), std::uint16_t, std::uint32_t>;
+
+    using Occupancy = std::array<std::uint64_t, (maxArea + 63) / 64>;
+
+    RuntimeBoard() = default;
+
+    explicit RuntimeBoard(unsigned int boardSize)
+        : mBoardSize{boardSize}
+    {
+        if (boardSize < 3) {
+            throw std::runtime_error{"Board is too small"};
+        }
+        if (boardSize > MaxBoardSize) {
+            throw std::runtime_error{"Board is too large"};
+        }
+    }
+
+    inline Cell neighbour(Cell cell, Direction direction) const {
+        const auto x {cell % mBoardSize}, y {cell / mBoardSize};
+
+        switch (direction) {
+            case Direction::Up: return static_cast<Cell>(y + 1 == mBoardSize ? cell - (area() - mBoardSize) : cell + mBoardSize);
+            case Direction::Down: return static_cast<Cell>(y == 0 ? cell + (area() - mBoardSize) : cell - mBoardSize);
+            case Direction::Left: return static_cast<Cell>(x == 0 ? cell + mBoardSize - 1 : cell - 1);
+            default: return static_cast<Cell>(x + 1 == mBoardSize ? cell - (mBoardSize - 1) : cell + 1);
+        }
+    }
+
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+    inline std::uint32_t area() const {
+        return mBoardSize * mBoardSize;
+    }
+
+    inline Cell cellIndex(const glm::uvec2& cell) const {
+        return static_cast<Cell>(cell.y * mBoardSize + cell.x);
+    }
+    inline glm::uvec2 cellPosition(Cell cell) const {
+        return {cell % mBoardSize, cell / mBoardSize};
+    }
+
+protected:
+    static inline bool isOccupied(const Occupancy& occupancy, Cell cell) {
+        return (occupancy[cell / 64] >> (cell % 64)) & 1;
+    }
+    static inline void occupy(Occupancy& occupancy, Cell cell) {
+        occupancy[cell / 64] |= std::uint64_t{1} << (cell % 64);
+    }
+    static inline void vacate(Occupancy& occupancy, Cell cell) {
+        occupancy[cell / 64] &= ~(std::uint64_t{1} << (cell % 64));
+    }
+
+private:
+    std::uint32_t mBoardSize {0};
+};
+
+/// `RingGame` on any board size up to `MaxBoardSize`, the occupancy in whole words
+template<unsigned int MaxBoardSize>
+using CompactGame = RingGame<RuntimeBoard<MaxBoardSize>>;
+
+}
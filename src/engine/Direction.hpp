@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glm/vec2.hpp>
+
+namespace app::engine {
+
+enum class Direction {Up, Down, Left, Right};
+
+inline int getMoveX(Direction direction) {
+    return (direction == Direction::Right) - (direction == Direction::Left);
+}
+
+inline int getMoveY(Direction direction) {
+    return (direction == Direction::Up) - (direction == Direction::Down);
+}
+
+inline Direction opposite(Direction direction) {
+    switch (direction) {
+        case Direction::Up: return Direction::Down;
+        case Direction::Down: return Direction::Up;
+        case Direction::Left: return Direction::Right;
+        default: return Direction::Left;
+    }
+}
+
+inline bool isOpposite(Direction a, Direction b) {
+    return opposite(a) == b;
+}
+
+/// Neighbour cell on a wrapping square board
+inline glm::uvec2 moveCell(const glm::uvec2& cell, Direction direction, unsigned int boardSize) {
+    return {
+        (cell.x + boardSize + getMoveX(direction)) % boardSize,
+        (cell.y + boardSize + getMoveY(direction)) % boardSize
+    };
+}
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <engine/RingGame.hpp>
+#include <bit>
+#include <bitset>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+namespace app::engine {
+
+/**
+ * Storage of an `Engine`: the board dimensions fixed at compile time, so wrapping compares against constants,
+ * power-of-two boards wrap with masks and treats are drawn with a constant modulus.
+ */
+template<unsigned int Width, unsigned int Height>
+class FixedBoard {
+    static_assert(Width >= 3 && Height >= 3, "Board is too small");
+
+public:
+    static constexpr unsigned int width {Width};
+    static constexpr unsigned int height {Height};
+    static constexpr size_t capacity {std::bit_ceil(static_cast<size_t>(Width) * Height)};
+    static constexpr bool powerOfTwo {std::has_single_bit(Width) && std::has_single_bit(Height)};
+
+    using Cell = std::conditional_t<(Width * Height <= 0x10000), std::uint16_t, std::uint32_t>;
+
+    using Occupancy = std::bitset<Width * Height>;
+
+    FixedBoard() = default;
+
+    /// Games only start on square boards, `boardSize` must match them
+    explicit FixedBoard(unsigned int boardSize) {
+        if (boardSize != Width || boardSize != Height) {
+            throw std::runtime_error{"Board size does not match the engine"};
+        }
+    }
+
+    static constexpr Cell neighbour(Cell cell, Direction direction) {
+        constexpr std::uint32_t area {Width * Height};
+
+        if constexpr (powerOfTwo) {
+            const std::uint32_t row {cell & ~(Width - 1u)};
+
+            switch (direction) {
+                case Direction::Up: return static_cast<Cell>((cell + Width) & (area - 1));
+                case Direction::Down: return static_cast<Cell>((cell + area - Width) & (area - 1));
+                case Direction::Left: return static_cast<Cell>(row | ((cell - 1u) & (Width - 1)));
+                default: return static_cast<Cell>(row | ((cell + 1u) & (Width - 1)));
+            }
+        } else {
+            const std::uint32_t x {cell % Width};
+
+            switch (direction) {
+                case Direction::Up: return static_cast<Cell>(cell >= area - Width ? cell - (area - Width) : cell + Width);
+                case Direction::Down: return static_cast<Cell>(cell < Width ? cell + (area - Width) : cell - Width);
+                case Direction::Left: return static_cast<Cell>(x == 0 ? cell + Width - 1 : cell - 1);
+                default: return static_cast<Cell>(x + 1 == Width ? cell - (Width - 1) : cell + 1);
+            }
+        }
+    }
+
+    static constexpr unsigned int boardSize() {
+        return Width;
+    }
+    static constexpr std::uint32_t area() {
+        return Width * Height;
+    }
+
+    static constexpr Cell cellIndex(const glm::uvec2& cell) {
+        return static_cast<Cell>(cell.y * Width + cell.x);
+    }
+    static constexpr glm::uvec2 cellPosition(Cell cell) {
+        return {cell % Width, cell / Width};
+    }
+
+protected:
+    static inline bool isOccupied(const Occupancy& occupancy, Cell cell) {
+        return occupancy[cell];
+    }
+    static inline void occupy(Occupancy& occupancy, Cell cell) {
+        occupancy[cell] = true;
+    }
+    static inline void vacate(Occupancy& occupancy, Cell cell) {
+        occupancy[cell] = false;
+    }
+};
+
+/**
+ * `RingGame` on one board size fixed at compile time.
+ * Same start, same treats and same outcomes as a `CompactGame` of that size with the same seed.
+ */
+template<unsigned int Width, unsigned int Height>
+using Engine = RingGame<FixedBoard<Width, Height>>;
+
+/**
+ * Calls `callback(std::type_identity<State>{})` with the `Engine` instantiated for `boardSize`,
+ * or with `Fallback`, usually a `CompactGame`, for any other size.
+ */
+template<typename Fallback, typename Callback>
+decltype(auto) withEngine(unsigned int boardSize, Callback&& callback) {
+    switch (boardSize) {
+        case 8: return callback(std::type_identity<Engine<8, 8>>{});
+        case 13: return callback(std::type_identity<Engine<13, 13>>{});
+        case 16: return callback(std::type_identity<Engine<16, 16>>{});
+        case 32: return callback(std::type_identity<Engine<32, 32>>{});
+        case 64: return callback(std::type_identity<Engine<64, 64>>{});
+        default: return callback(std::type_identity<Fallback>{});
+    }
+}
+
+}
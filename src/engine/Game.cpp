@@ -0,0 +1,251 @@
+#include "Game.hpp"
+#include <bit>
+#include <stdexcept>
+
+namespace app::engine {
+
+//region Constructor & Destructor
+
+Game::Game(unsigned int boardSize, unsigned int seed)
+    : mBoardSize{boardSize}
+    , mBody{boardSize}
+    , mBlocked{boardSize}
+{
+    if (boardSize < 3) {
+        throw std::runtime_error{"Board is too small"};
+    }
+
+    reset(seed);
+}
+
+Game::Game(unsigned int boardSize, Body body, glm::uvec2 treat, unsigned int seed)
+    : mBoardSize{boardSize}
+    , mRandom{seed}
+    , mBody{std::move(body)}
+    , mBlocked{boardSize}
+    , mDirection{mBody.empty() ? Direction::Up : mBody.front().second}
+    , mNextDirection{mDirection}
+{
+    if (mBody.boardSize() != boardSize) {
+        throw std::runtime_error{"Body is for another board"};
+    }
+    if (mBody.size() < 2) {
+        throw std::runtime_error{"Invalid snake length"};
+    }
+
+    addTreat(treat);
+}
+
+Game::Game(std::shared_ptr<const Level> level, unsigned int seed)
+    : mBoardSize{level->size()}
+    , mLevel{std::move(level)}
+    , mBody{mBoardSize}
+    , mBlocked{mBoardSize}
+{
+    mBlocked.merge(mLevel->words());
+    reset(seed);
+}
+
+//endregion
+
+//region Public Methods
+
+bool Game::setNextDirection(Direction direction) {
+    if (isOpposite(direction, mDirection)) {
+        return false;
+    }
+
+    mNextDirection = direction;
+
+    return true;
+}
+
+GameState Game::move() {
+    if (mState != GameState::Running) {
+        return mState;
+    }
+
+    mDirection = mNextDirection;
+
+    const auto nextHead {getNextHead()};
+
+    if (mTreats.contains(nextHead)) {
+        // right after another treat the tail still owes that one its growth
+        if (!mSkipTailMove) {
+            mBody.popBack();
+        }
+        mSkipTailMove = true;
+        mBody.pushFront(nextHead, mDirection);
+
+        // the tail stays in place on the next move, that last segment fills the board
+        if (mBody.size() + 1 >= freeCells()) {
+            return mState = GameState::Won;
+        }
+
+        removeTreat(nextHead);
+        spawnTreat();
+    } else {
+        // the body stays as it was on a bump
+        const bool tailMoves {!mSkipTailMove};
+        if (isWall(nextHead)) {
+            return mState = GameState::Lost;
+        }
+        if (isOnBody(nextHead) && !(tailMoves && nextHead == mBody.cell(mBody.size() - 1))) {
+            return mState = GameState::Lost;
+        }
+
+        if (tailMoves) {
+            mBody.popBack();
+        }
+        mSkipTailMove = false;
+
+        mBody.pushFront(nextHead, mDirection);
+    }
+
+    return mState;
+}
+
+void Game::setPaused(bool paused) {
+    if (paused && mState == GameState::Running) {
+        mState = GameState::Paused;
+    } else if (!paused && mState == GameState::Paused) {
+        mState = GameState::Running;
+    }
+}
+
+void Game::reset(unsigned int seed) {
+    mRandom.seed(seed);
+
+    mBody.clear();
+    auto cell {mLevel ? mLevel->start() : glm::uvec2{mBoardSize / 2, 2}};
+    for (int i = 0; i < 3; ++i) {
+        mBody.pushBack(cell, Direction::Up);
+        cell = moveCell(cell, Direction::Down, mBoardSize);
+    }
+
+    while (!mTreats.empty()) {
+        removeTreat(mTreats[mTreats.size() - 1].cell);
+    }
+    mDirection = Direction::Up;
+    mNextDirection = Direction::Up;
+    mSkipTailMove = false;
+    mState = GameState::Running;
+
+    // levels start anywhere, the treat moves out of the way
+    if (mLevel && (isWall({2, 2}) || isOnBody({2, 2}))) {
+        spawnTreat();
+    } else {
+        addTreat({2, 2});
+    }
+    while (mTreats.size() < mTreatCount) {
+        spawnTreat();
+    }
+}
+
+glm::uvec2 Game::getNextHead() const {
+    return moveCell(mBody.cell(0), mDirection, mBoardSize);
+}
+
+void Game::placeTreat() {
+    removeTreat(treat());
+    spawnTreat();
+}
+
+void Game::setTreatCount(size_t count) {
+    if (count == 0 || count > freeCells() / 2) {
+        throw std::runtime_error{"Invalid treat count"};
+    }
+
+    mTreatCount = count;
+    mTreats.reserve(count);
+    while (mTreats.size() > count) {
+        removeTreat(mTreats[mTreats.size() - 1].cell);
+    }
+    while (mTreats.size() < count) {
+        spawnTreat();
+    }
+}
+
+//endregion
+
+//region Private Methods
+
+void Game::spawnTreat() {
+    if (mBody.size() + mTreats.size() >= freeCells()) {
+        return;
+    }
+    const auto free {freeCells() - mBody.size() - mTreats.size()};
+
+    // retrying a random cell takes at most 64 tries on average, a nearly full board is scanned instead
+    glm::uvec2 cell {};
+    if (free * 64 >= static_cast<std::uint64_t>(mBoardSize) * mBoardSize) {
+        do {
+            cell = randomCell();
+        } while (mBlocked.test(cell) || isOnBody(cell));
+    } else {
+        cell = freeCell(std::uniform_int_distribution<std::uint64_t>{0, free - 1}(mRandom));
+    }
+
+    // a lone treat draws nothing more, games with one stay as they were for a seed
+    auto kind {TreatKind::Plain};
+    if (mTreatCount > 1) {
+        const auto roll {std::uniform_int_distribution<unsigned int>{0, 19}(mRandom)};
+        kind = roll == 0 ? TreatKind::Rare : roll < 4 ? TreatKind::Bonus : TreatKind::Plain;
+    }
+
+    addTreat(cell, kind);
+}
+
+void Game::addTreat(const glm::uvec2& cell, TreatKind kind) {
+    mTreats.spawn(cell, kind);
+    mBlocked.set(cell);
+}
+
+void Game::removeTreat(const glm::uvec2& cell) {
+    mTreats.despawn(cell);
+    mBlocked.reset(cell);
+}
+
+glm::uvec2 Game::randomCell() {
+    std::uniform_int_distribution<unsigned int> distribution {0, mBoardSize - 1};
+
+    return {distribution(mRandom), distribution(mRandom)};
+}
+
+glm::uvec2 Game::freeCell(std::uint64_t index) const {
+    const auto& body {mBody.occupancy()};
+    const auto words {mBlocked.wordsPerRow()};
+    // bits past the board in the last word of a row
+    const auto padding {mBoardSize % 64 == 0 ? 0 : ~std::uint64_t{0} << (mBoardSize % 64)};
+
+    for (unsigned int y = 0; y < mBoardSize; ++y) {
+        const auto blocked {mBlocked.row(y)}, occupied {body.row(y)};
+        for (unsigned int w = 0; w < words; ++w) {
+            auto free {~(blocked[w] | occupied[w] | (w + 1 == words ? padding : 0))};
+            const auto count {static_cast<std::uint64_t>(std::popcount(free))};
+            if (index >= count) {
+                index -= count;
+                continue;
+            }
+
+            for (; index > 0; --index) {
+                free &= free - 1;
+            }
+            return {w * 64 + std::countr_zero(free), y};
+        }
+    }
+
+    throw std::runtime_error{"No free cell"};
+}
+
+bool Game::isOnBody(const glm::uvec2& cell) const {
+    return mBody.contains(cell);
+}
+
+std::uint64_t Game::freeCells() const {
+    return mLevel ? mLevel->freeCells() : static_cast<std::uint64_t>(mBoardSize) * mBoardSize;
+}
+
+//endregion
+
+}
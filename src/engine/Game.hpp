@@ -0,0 +1,109 @@
+#pragma once
+
+#include <engine/Body.hpp>
+#include <engine/Direction.hpp>
+#include <engine/Level.hpp>
+#include <engine/TreatField.hpp>
+#include <glm/vec2.hpp>
+#include <memory>
+#include <random>
+#include <utility>
+
+namespace app::engine {
+
+enum class GameState {Running, Lost, Won, Paused};
+
+/**
+ * Headless game rules: the snake body, its direction and the treats on a wrapping square board, with the walls of a level.
+ * Knows nothing about time or rendering, `move()` is one step of the game and returns the state after it.
+ * Every eaten treat is replaced at once, so their count stays the same until the board runs out of room.
+ */
+class Game {
+public:
+    explicit Game(unsigned int boardSize, unsigned int seed = std::random_device{}());
+    explicit Game(unsigned int boardSize, Body body, glm::uvec2 treat, unsigned int seed = std::random_device{}());
+    explicit Game(std::shared_ptr<const Level> level, unsigned int seed = std::random_device{}());
+
+    Game(Game &&other) noexcept = default;
+    Game & operator=(Game &&other) noexcept = default;
+    ~Game() noexcept = default;
+
+    bool setNextDirection(Direction direction);
+    /// One step while running, does nothing otherwise
+    GameState move();
+    glm::uvec2 getNextHead() const;
+    /// Replaces the first treat with one at a random free cell, as after eating
+    void placeTreat();
+    /// Treats on the board at once, spawns or despawns the difference now. One by default
+    void setTreatCount(size_t count);
+    /// Only switches between running and paused
+    void setPaused(bool paused);
+    /// Starts over on the same board, without allocating
+    void reset(unsigned int seed);
+
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+    inline const Body& body() const {
+        return mBody;
+    }
+    /// The first treat, the only one by default
+    inline const glm::uvec2& treat() const {
+        return mTreats[0].cell;
+    }
+    inline const TreatField& treats() const {
+        return mTreats;
+    }
+    /// Treats kept on the board, fewer may be left once the body nearly fills it
+    inline size_t treatCount() const {
+        return mTreatCount;
+    }
+    inline bool isTreat(const glm::uvec2& cell) const {
+        return mTreats.contains(cell);
+    }
+    inline Direction direction() const {
+        return mDirection;
+    }
+    inline bool skipTailMove() const {
+        return mSkipTailMove;
+    }
+    inline GameState state() const {
+        return mState;
+    }
+    /// Empty board without one
+    inline const std::shared_ptr<const Level>& level() const {
+        return mLevel;
+    }
+    inline bool isWall(const glm::uvec2& cell) const {
+        return mLevel && mLevel->isWall(cell);
+    }
+
+private:
+    /// A treat at a random free cell, none when the body and the treats fill the board
+    void spawnTreat();
+    void addTreat(const glm::uvec2& cell, TreatKind kind = TreatKind::Plain);
+    void removeTreat(const glm::uvec2& cell);
+    glm::uvec2 randomCell();
+    /// The `index`-th cell that is neither body, wall nor treat, row by row
+    glm::uvec2 freeCell(std::uint64_t index) const;
+    bool isOnBody(const glm::uvec2& cell) const;
+    std::uint64_t freeCells() const;
+
+private:
+    unsigned int mBoardSize;
+    std::shared_ptr<const Level> mLevel;
+    std::minstd_rand mRandom;
+
+    Body mBody;
+    TreatField mTreats {};
+    Bitboard mBlocked; // walls and treats, the body keeps its own cells
+    size_t mTreatCount {1};
+
+    Direction mDirection {Direction::Up};
+    Direction mNextDirection {Direction::Up};
+
+    bool mSkipTailMove {false};
+    GameState mState {GameState::Running};
+};
+
+}
@@ -0,0 +1,136 @@
+#include "HamiltonianCycle.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace app::engine {
+
+namespace {
+
+constexpr std::uint32_t fileMagic {0x48434E53}; // "SNCH"
+constexpr std::uint32_t fileVersion {1};
+
+}
+
+//region Constructor & Destructor
+
+HamiltonianCycle::HamiltonianCycle(unsigned int boardSize, std::vector<std::uint32_t> order)
+    : mBoardSize{boardSize}
+    , mOrder{std::move(order)}
+    , mCells(mOrder.size())
+{
+    std::vector<bool> seen(mOrder.size());
+
+    for (size_t index = 0; index < mOrder.size(); ++index) {
+        const auto position {mOrder[index]};
+        if (position >= mOrder.size() || seen[position]) {
+            throw std::runtime_error{"Invalid Hamiltonian cycle"};
+        }
+        seen[position] = true;
+        mCells[position] = {index % boardSize, index / boardSize};
+    }
+
+    for (std::uint32_t position = 0; position < mCells.size(); ++position) {
+        const auto from {mCells[position]}, to {mCells[(position + 1) % mCells.size()]};
+        const auto dx {(to.x + boardSize - from.x) % boardSize}, dy {(to.y + boardSize - from.y) % boardSize};
+        if (!((dx == 0) ^ (dy == 0)) || (dx != 0 && dx != 1 && dx != boardSize - 1) || (dy != 0 && dy != 1 && dy != boardSize - 1)) {
+            throw std::runtime_error{"Invalid Hamiltonian cycle"};
+        }
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+std::shared_ptr<const HamiltonianCycle> HamiltonianCycle::generate(unsigned int boardSize) {
+    if (boardSize < 3) {
+        throw std::runtime_error{"Board is too small"};
+    }
+
+    const size_t area {static_cast<size_t>(boardSize) * boardSize};
+    std::vector<std::uint32_t> order(area);
+
+    for (std::uint32_t position = 0; position < area; ++position) {
+        const auto row {position / boardSize};
+        const auto column {position % boardSize};
+        const auto x {(column + boardSize - row) % boardSize};
+
+        order[static_cast<size_t>(row) * boardSize + x] = position;
+    }
+
+    return std::shared_ptr<const HamiltonianCycle>{new HamiltonianCycle{boardSize, std::move(order)}};
+}
+
+std::shared_ptr<const HamiltonianCycle> HamiltonianCycle::load(
+    unsigned int boardSize, const std::filesystem::path& cacheDirectory
+) {
+    const auto path {cacheDirectory / ("hamiltonian-" + std::to_string(boardSize) + ".bin")};
+    const size_t area {static_cast<size_t>(boardSize) * boardSize};
+
+    if (std::ifstream file {path, std::ios::binary}; file) {
+        std::uint32_t header[3] {};
+        std::vector<std::uint32_t> order(area);
+
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+        file.read(reinterpret_cast<char*>(order.data()), area * sizeof(std::uint32_t));
+
+        if (file && header[0] == fileMagic && header[1] == fileVersion && header[2] == boardSize) {
+            try {
+                return std::shared_ptr<const HamiltonianCycle>{new HamiltonianCycle{boardSize, std::move(order)}};
+            } catch (const std::runtime_error&) {
+                // corrupted, generate again
+            }
+        }
+    }
+
+    auto cycle {generate(boardSize)};
+
+    // the cache is an optimization, failing to write it is not an error
+    std::error_code error {};
+    std::filesystem::create_directories(cacheDirectory, error);
+    const auto temporaryPath {std::filesystem::path{path}.concat(".tmp")};
+    if (std::ofstream file {temporaryPath, std::ios::binary | std::ios::trunc}; file) {
+        const std::uint32_t header[3] {fileMagic, fileVersion, boardSize};
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(cycle->mOrder.data()), area * sizeof(std::uint32_t));
+        file.close();
+
+        if (file) {
+            std::filesystem::rename(temporaryPath, path, error);
+        }
+    }
+
+    return cycle;
+}
+
+std::filesystem::path HamiltonianCycle::defaultCacheDirectory() {
+    if (const auto directory {std::getenv("SNAKE_CACHE_DIR")}; directory != nullptr) {
+        return directory;
+    }
+    if (const auto directory {std::getenv("XDG_CACHE_HOME")}; directory != nullptr) {
+        return std::filesystem::path{directory} / "snake-game-opengl";
+    }
+    if (const auto home {std::getenv("HOME")}; home != nullptr) {
+        return std::filesystem::path{home} / ".cache" / "snake-game-opengl";
+    }
+    return std::filesystem::temp_directory_path() / "snake-game-opengl";
+}
+
+Direction HamiltonianCycle::direction(const glm::uvec2& from) const {
+    const auto to {mCells[(order(from) + 1) % area()]};
+
+    if (to.x == (from.x + 1) % mBoardSize && to.y == from.y) {
+        return Direction::Right;
+    }
+    if (to.x == (from.x + mBoardSize - 1) % mBoardSize && to.y == from.y) {
+        return Direction::Left;
+    }
+    return to.y == (from.y + 1) % mBoardSize ? Direction::Up : Direction::Down;
+}
+
+//endregion
+
+}
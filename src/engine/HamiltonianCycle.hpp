@@ -0,0 +1,52 @@
+#pragma once
+
+#include <engine/Direction.hpp>
+#include <glm/vec2.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace app::engine {
+
+/**
+ * A closed path through every cell of the wrapping board: each row is walked to the right,
+ * then one step up leads to the next row shifted one cell to the left. Works for any board size.
+ */
+class HamiltonianCycle {
+public:
+    static std::shared_ptr<const HamiltonianCycle> generate(unsigned int boardSize);
+    /// Reads `hamiltonian-<size>.bin` from the cache directory, or generates and stores it
+    static std::shared_ptr<const HamiltonianCycle> load(unsigned int boardSize, const std::filesystem::path& cacheDirectory);
+    static std::filesystem::path defaultCacheDirectory();
+
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+    inline std::uint32_t area() const {
+        return static_cast<std::uint32_t>(mOrder.size());
+    }
+    /// Position of the cell on the cycle
+    inline std::uint32_t order(const glm::uvec2& cell) const {
+        return mOrder[static_cast<size_t>(cell.y) * mBoardSize + cell.x];
+    }
+    /// Steps forward along the cycle from one cell to the other
+    inline std::uint32_t distance(const glm::uvec2& from, const glm::uvec2& to) const {
+        const auto a {order(from)}, b {order(to)};
+        return b >= a ? b - a : b + area() - a;
+    }
+    inline glm::uvec2 cell(std::uint32_t order) const {
+        return mCells[order];
+    }
+    Direction direction(const glm::uvec2& from) const;
+
+private:
+    explicit HamiltonianCycle(unsigned int boardSize, std::vector<std::uint32_t> order);
+
+private:
+    unsigned int mBoardSize;
+    std::vector<std::uint32_t> mOrder; // cell index -> position on the cycle
+    std::vector<glm::uvec2> mCells;    // position on the cycle -> cell
+};
+
+}
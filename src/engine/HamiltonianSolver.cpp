@@ -0,0 +1,70 @@
+#include "HamiltonianSolver.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace app::engine {
+
+//region Constructor & Destructor
+
+HamiltonianSolver::HamiltonianSolver(std::shared_ptr<const HamiltonianCycle> cycle)
+    : mCycle{std::move(cycle)}
+{
+    if (!mCycle) {
+        throw std::runtime_error{"Missing Hamiltonian cycle"};
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+Direction HamiltonianSolver::decide(const Game& game) const {
+    const auto& body {game.body()};
+    const auto head {body.front().first};
+    const auto gap {mCycle->distance(head, body.back().first)};
+    // the first treat ahead along the cycle
+    auto treat {mCycle->area()};
+    for (const auto& candidate : game.treats().treats()) {
+        treat = std::min(treat, mCycle->distance(head, candidate.cell));
+    }
+
+    // never jump over the treat when it lies in the gap, and stay away from the tail
+    auto limit {treat < gap ? treat : gap};
+    limit = gap > tailMargin + 1 ? std::min(limit, gap - tailMargin - 1) : 1;
+
+    auto best {mCycle->direction(head)};
+    std::uint32_t bestDistance {1};
+
+    for (const auto direction : {Direction::Up, Direction::Down, Direction::Left, Direction::Right}) {
+        if (isOpposite(direction, game.direction())) {
+            continue;
+        }
+
+        const auto distance {mCycle->distance(head, moveCell(head, direction, game.boardSize()))};
+        if (distance > bestDistance && distance <= limit) {
+            best = direction;
+            bestDistance = distance;
+        }
+    }
+
+    return best;
+}
+
+bool HamiltonianSolver::isAligned(const Game& game) const {
+    if (game.boardSize() != mCycle->boardSize()) {
+        return false;
+    }
+
+    const auto& body {game.body()};
+    std::uint64_t span {0};
+
+    for (size_t index = body.size() - 1; index > 0; --index) {
+        span += mCycle->distance(body[index].first, body[index - 1].first);
+    }
+
+    return span < mCycle->area();
+}
+
+//endregion
+
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <engine/Game.hpp>
+#include <engine/HamiltonianCycle.hpp>
+#include <memory>
+
+namespace app::engine {
+
+/**
+ * Perfect player: follows a Hamiltonian cycle, so it never bumps and always fills the board.
+ *
+ * While the body lies along the cycle order from the tail to the head, every cell after the head
+ * and before the tail is free. A neighbour in that gap is a safe shortcut as long as it keeps
+ * a margin to the tail and does not jump over the next treat along the cycle, which makes each decision O(1)
+ * with one treat and linear in the treats with more.
+ */
+class HamiltonianSolver {
+public:
+    explicit HamiltonianSolver(std::shared_ptr<const HamiltonianCycle> cycle);
+
+    Direction decide(const Game& game) const;
+    /// Whether the body follows the cycle order, as a new game does. Otherwise `decide()` guarantees nothing
+    bool isAligned(const Game& game) const;
+
+    inline const HamiltonianCycle& cycle() const {
+        return *mCycle;
+    }
+
+    /// Free cells kept between the head and the tail when cutting, covers the growth after a treat
+    static constexpr std::uint32_t tailMargin {3};
+
+private:
+    std::shared_ptr<const HamiltonianCycle> mCycle;
+};
+
+}
@@ -0,0 +1,97 @@
+#include "Level.hpp"
+#include <engine/Direction.hpp>
+#include <fstream>
+#include <stdexcept>
+
+namespace app::engine {
+
+namespace {
+
+constexpr std::uint32_t fileMagic {0x4C4B4E53}; // "SNKL"
+constexpr std::uint32_t fileVersion {1};
+
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t size;
+    std::uint32_t startX;
+    std::uint32_t startY;
+    std::uint32_t wordsPerRow;
+    std::uint64_t freeCells;
+};
+
+static_assert(sizeof(Header) == 32);
+
+}
+
+//region Public Methods
+
+std::shared_ptr<const Level> Level::load(const std::filesystem::path& path) {
+    std::shared_ptr<Level> level {new Level{}};
+    level->mFile = util::MappedFile{path};
+
+    const auto data {level->mFile.data()};
+    if (data.size() < sizeof(Header)) {
+        throw std::runtime_error{"Invalid level " + path.string()};
+    }
+
+    const auto& header {*reinterpret_cast<const Header*>(data.data())};
+    if (header.magic != fileMagic || header.version != fileVersion) {
+        throw std::runtime_error{"Invalid level " + path.string()};
+    }
+    if (header.size < 3 || header.wordsPerRow != (header.size + 63) / 64 || header.startX >= header.size || header.startY >= header.size) {
+        throw std::runtime_error{"Invalid level " + path.string()};
+    }
+
+    const size_t wordCount {static_cast<size_t>(header.size) * header.wordsPerRow};
+    if (data.size() != sizeof(Header) + wordCount * sizeof(std::uint64_t)) {
+        throw std::runtime_error{"Truncated level " + path.string()};
+    }
+
+    level->mSize = header.size;
+    level->mWordsPerRow = header.wordsPerRow;
+    level->mStart = {header.startX, header.startY};
+    level->mFreeCells = header.freeCells;
+    level->mWords = {reinterpret_cast<const std::uint64_t*>(data.data() + sizeof(Header)), wordCount};
+
+    // the start is checked, the rest of the map stays on disk until it is read
+    auto cell {level->mStart};
+    for (int i = 0; i < 3; ++i) {
+        if (level->isWall(cell)) {
+            throw std::runtime_error{"Snake starts on a wall in " + path.string()};
+        }
+        cell = moveCell(cell, Direction::Down, header.size);
+    }
+    if (header.freeCells < 4 || header.freeCells > static_cast<std::uint64_t>(header.size) * header.size) {
+        throw std::runtime_error{"Invalid level " + path.string()};
+    }
+
+    return level;
+}
+
+void Level::write(const std::filesystem::path& path, const Bitboard& walls, const glm::uvec2& start) {
+    const Header header {
+        fileMagic,
+        fileVersion,
+        walls.size(),
+        start.x,
+        start.y,
+        walls.wordsPerRow(),
+        static_cast<std::uint64_t>(walls.size()) * walls.size() - walls.count(),
+    };
+
+    std::ofstream file {path, std::ios::binary | std::ios::trunc};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (unsigned int y = 0; y < walls.size(); ++y) {
+        file.write(reinterpret_cast<const char*>(walls.row(y)), static_cast<std::streamsize>(walls.wordsPerRow() * sizeof(std::uint64_t)));
+    }
+    file.close();
+
+    if (!file) {
+        throw std::runtime_error{"Unable to write " + path.string()};
+    }
+}
+
+//endregion
+
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <engine/Bitboard.hpp>
+#include <util/MappedFile.hpp>
+#include <glm/vec2.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace app::engine {
+
+/**
+ * Walls of a wrapping square board, memory-mapped from a `.level` file so only the rows that are read
+ * get paged in. The file is a header {"SNKL", version, size, start x, start y, words per row, free cells}
+ * followed by one bit per cell in the row layout of `Bitboard`, every row padded to whole 64-bit words.
+ * The snake starts with its head on the start cell, heading up, the body below it.
+ */
+class Level {
+public:
+    /// Throws for files that are not a valid level
+    static std::shared_ptr<const Level> load(const std::filesystem::path& path);
+    static void write(const std::filesystem::path& path, const Bitboard& walls, const glm::uvec2& start);
+
+    inline unsigned int size() const {
+        return mSize;
+    }
+    inline const glm::uvec2& start() const {
+        return mStart;
+    }
+    /// Cells a snake can fill, the board area without the walls
+    inline std::uint64_t freeCells() const {
+        return mFreeCells;
+    }
+    inline unsigned int wordsPerRow() const {
+        return mWordsPerRow;
+    }
+    /// All rows in `Bitboard` layout
+    inline std::span<const std::uint64_t> words() const {
+        return mWords;
+    }
+
+    inline bool isWall(const glm::uvec2& cell) const {
+        return (mWords[static_cast<size_t>(cell.y) * mWordsPerRow + cell.x / 64] >> (cell.x % 64)) & 1;
+    }
+
+private:
+    Level() = default;
+
+private:
+    util::MappedFile mFile;
+    unsigned int mSize {0};
+    unsigned int mWordsPerRow {0};
+    glm::uvec2 mStart {};
+    std::uint64_t mFreeCells {0};
+    std::span<const std::uint64_t> mWords;
+};
+
+}
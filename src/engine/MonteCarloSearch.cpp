@@ -0,0 +1,253 @@
+#include "MonteCarloSearch.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace app::engine {
+
+namespace {
+
+constexpr std::array<Direction, 4> directions {Direction::Up, Direction::Down, Direction::Left, Direction::Right};
+
+}
+
+//region Constructor & Destructor
+
+MonteCarloSearch::MonteCarloSearch(unsigned int threads)
+    : MonteCarloSearch{threads, Settings{}}
+{}
+
+MonteCarloSearch::MonteCarloSearch(unsigned int threads, const Settings& settings)
+    : mSettings{settings}
+    , mPool{threads}
+    , mWorkers(mPool.size())
+{
+    for (auto& worker : mWorkers) {
+        worker.nodes.reserve(mSettings.iterations + 1);
+        worker.path.reserve(64);
+        worker.rewards.reserve(64);
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+Direction MonteCarloSearch::decide(const Game& game) {
+    return search(State{game, mSettings.seed + mSearches});
+}
+
+Direction MonteCarloSearch::search(const State& root) {
+    const auto begin {std::chrono::steady_clock::now()};
+    const auto searchIndex {++mSearches};
+
+    mPool.run([&](unsigned int index) {
+        auto& worker {mWorkers[index]};
+
+        worker.random = (mSettings.seed * 0x9E3779B9u) ^ (searchIndex * 0x85EBCA6Bu) ^ ((index + 1) * 0xC2B2AE35u);
+        if (worker.random == 0) {
+            worker.random = 1;
+        }
+        worker.simulatedMoves = 0;
+        worker.nodes.clear();
+        worker.nodes.emplace_back();
+
+        for (size_t i = 0; i < mSettings.iterations; ++i) {
+            grow(worker, root);
+        }
+    });
+
+    // merge the first moves of all trees
+    std::array<std::uint64_t, 4> visits {};
+    std::array<double, 4> values {};
+    mStatistics = {};
+
+    for (const auto& worker : mWorkers) {
+        const auto& rootNode {worker.nodes.front()};
+
+        for (size_t d = 0; d < directions.size(); ++d) {
+            if (const auto child {rootNode.children[d]}; child != 0) {
+                visits[d] += worker.nodes[child].visits;
+                values[d] += static_cast<double>(worker.nodes[child].value) * worker.nodes[child].visits;
+            }
+        }
+
+        mStatistics.rollouts += rootNode.visits;
+        mStatistics.simulatedMoves += worker.simulatedMoves;
+    }
+
+    auto best {root.direction()};
+    std::uint64_t bestVisits {0};
+    double bestValue {0};
+
+    for (size_t d = 0; d < directions.size(); ++d) {
+        if (visits[d] == 0) {
+            continue;
+        }
+
+        const auto value {values[d] / static_cast<double>(visits[d])};
+        if (visits[d] > bestVisits || (visits[d] == bestVisits && value > bestValue)) {
+            best = directions[d];
+            bestVisits = visits[d];
+            bestValue = value;
+        }
+    }
+
+    mStatistics.elapsed = std::chrono::steady_clock::now() - begin;
+
+    return best;
+}
+
+//endregion
+
+//region Private Methods
+
+void MonteCarloSearch::grow(Worker& worker, const State& root) {
+    auto state {root};
+    state.reseed(next(worker.random));
+
+    worker.path.clear();
+    worker.rewards.clear();
+    worker.path.push_back(0);
+
+    std::uint32_t node {0};
+    float tail {0};
+
+    for (;;) {
+        const auto direction {select(worker, worker.nodes[node], state)};
+        const auto slot {static_cast<size_t>(direction)};
+
+        auto child {worker.nodes[node].children[slot]};
+        const bool expanding {child == 0};
+        if (expanding) {
+            child = static_cast<std::uint32_t>(worker.nodes.size());
+            worker.nodes.emplace_back();
+            worker.nodes[node].children[slot] = child;
+        }
+
+        state.setNextDirection(direction);
+        const auto outcome {state.move()};
+        ++worker.simulatedMoves;
+
+        worker.path.push_back(child);
+        worker.rewards.push_back(reward(outcome));
+
+        if (isTerminal(outcome)) {
+            break;
+        }
+        if (expanding) {
+            tail = rollout(worker, state);
+            break;
+        }
+
+        node = child;
+    }
+
+    // back up discounted returns from the leaf to the root
+    auto value {tail};
+    for (size_t i = worker.path.size() - 1; i > 0; --i) {
+        value = worker.rewards[i - 1] + mSettings.discount * value;
+
+        auto& pathNode {worker.nodes[worker.path[i]]};
+        ++pathNode.visits;
+        pathNode.value += (value - pathNode.value) / static_cast<float>(pathNode.visits);
+    }
+    ++worker.nodes.front().visits;
+}
+
+Direction MonteCarloSearch::select(Worker& worker, const Node& node, const State& state) const {
+    // try every direction once, in random order
+    std::array<Direction, 4> unexpanded {};
+    size_t unexpandedCount {0};
+
+    for (size_t d = 0; d < directions.size(); ++d) {
+        if (!isOpposite(directions[d], state.direction()) && node.children[d] == 0) {
+            unexpanded[unexpandedCount++] = directions[d];
+        }
+    }
+    if (unexpandedCount > 0) {
+        return unexpanded[next(worker.random) % unexpandedCount];
+    }
+
+    auto best {state.direction()};
+    auto bestScore {-INFINITY};
+    const auto logVisits {std::log(static_cast<float>(std::max<std::uint32_t>(node.visits, 1)))};
+
+    for (size_t d = 0; d < directions.size(); ++d) {
+        if (isOpposite(directions[d], state.direction())) {
+            continue;
+        }
+
+        const auto& child {worker.nodes[node.children[d]]};
+        const auto visits {static_cast<float>(std::max<std::uint32_t>(child.visits, 1))};
+        const auto score {child.value + mSettings.exploration * std::sqrt(logVisits / visits)};
+
+        if (score > bestScore) {
+            best = directions[d];
+            bestScore = score;
+        }
+    }
+
+    return best;
+}
+
+float MonteCarloSearch::rollout(Worker& worker, State& state) const {
+    float value {0};
+    float weight {1};
+
+    for (unsigned int depth = 0; depth < mSettings.rolloutDepth; ++depth) {
+        // random direction that does not bump right away, when there is one
+        std::array<Direction, 3> safe {};
+        size_t safeCount {0};
+        auto fallback {state.direction()};
+
+        for (const auto direction : directions) {
+            if (isOpposite(direction, state.direction())) {
+                continue;
+            }
+
+            const auto cell {state.neighbour(state.head(), direction)};
+            if (!state.isOccupied(cell) || (cell == state.tail() && !state.skipTailMove())) {
+                safe[safeCount++] = direction;
+            }
+            fallback = direction;
+        }
+
+        state.setNextDirection(safeCount > 0 ? safe[next(worker.random) % safeCount] : fallback);
+        const auto outcome {state.move()};
+        ++worker.simulatedMoves;
+
+        value += weight * reward(outcome);
+        weight *= mSettings.discount;
+
+        if (isTerminal(outcome)) {
+            break;
+        }
+    }
+
+    return value;
+}
+
+float MonteCarloSearch::reward(Outcome outcome) {
+    switch (outcome) {
+        case Outcome::Ate: return 1.0f;
+        case Outcome::Won: return 10.0f;
+        case Outcome::Lost: return -10.0f;
+        default: return 0.0f;
+    }
+}
+
+bool MonteCarloSearch::isTerminal(Outcome outcome) {
+    return outcome == Outcome::Lost || outcome == Outcome::Won;
+}
+
+std::uint32_t MonteCarloSearch::next(std::uint32_t& random) {
+    // xorshift32
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    return random;
+}
+
+//endregion
+
+}
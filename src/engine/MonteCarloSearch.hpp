@@ -0,0 +1,80 @@
+#pragma once
+
+#include <engine/CompactGame.hpp>
+#include <util/ThreadPool.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace app::engine {
+
+/**
+ * Root-parallel Monte Carlo tree search: every worker grows its own tree from the same root
+ * and the visit counts of the first moves are summed. The tree is open-loop, nodes are sequences of
+ * directions and each iteration replays them on a fresh clone of the root with its own treat randomness.
+ * The clones model one treat, the first of the game.
+ */
+class MonteCarloSearch {
+public:
+    using State = CompactGame<32>;
+
+    struct Settings {
+        size_t iterations {2000}; // per worker and decision
+        unsigned int rolloutDepth {48};
+        float exploration {1.0f};
+        float discount {0.97f};
+        std::uint32_t seed {1};
+    };
+
+    struct Statistics {
+        size_t rollouts {0};
+        size_t simulatedMoves {0};
+        std::chrono::nanoseconds elapsed {0};
+    };
+
+    /// 0 threads - one per core
+    explicit MonteCarloSearch(unsigned int threads = 0);
+    explicit MonteCarloSearch(unsigned int threads, const Settings& settings);
+
+    Direction decide(const Game& game);
+    Direction search(const State& root);
+
+    inline const Statistics& statistics() const {
+        return mStatistics;
+    }
+    inline unsigned int threads() const {
+        return mPool.size();
+    }
+
+private:
+    struct Node {
+        std::array<std::uint32_t, 4> children {}; // by direction, 0 - not expanded
+        std::uint32_t visits {0};
+        float value {0}; // mean discounted return after reaching this node
+    };
+
+    struct Worker {
+        std::vector<Node> nodes;
+        std::vector<std::uint32_t> path;
+        std::vector<float> rewards;
+        std::uint32_t random {1};
+        size_t simulatedMoves {0};
+    };
+
+    void grow(Worker& worker, const State& root);
+    Direction select(Worker& worker, const Node& node, const State& state) const;
+    float rollout(Worker& worker, State& state) const;
+    static float reward(Outcome outcome);
+    static bool isTerminal(Outcome outcome);
+    static std::uint32_t next(std::uint32_t& random);
+
+private:
+    Settings mSettings;
+    util::ThreadPool mPool;
+    std::vector<Worker> mWorkers;
+    std::uint32_t mSearches {0};
+    Statistics mStatistics {};
+};
+
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <engine/Game.hpp>
+#include <array>
+#include <cstdint>
+
+namespace app::engine {
+
+enum class Outcome : std::uint8_t {Moved, Ate, Lost, Won};
+
+/**
+ * Same rules as `Game` in one flat, trivially copyable block: the body is a ring of cell indices
+ * and the occupied cells are a bit set, so a copy is a clone and an assignment is a restore.
+ * Every step reports what happened, including treats, which is what simulated rollouts score.
+ *
+ * `Board` is the storage: the cell type, how cells wrap and how the bit set is laid out, see `CompactGame` and `Engine`.
+ * The rules are written once here for both.
+ */
+template<typename Board>
+class RingGame : public Board {
+public:
+    using Cell = typename Board::Cell;
+    using Occupancy = typename Board::Occupancy;
+
+    static constexpr size_t capacity {Board::capacity};
+
+    RingGame() = default;
+
+    /// Same start as `Game(boardSize, seed)`
+    explicit RingGame(unsigned int boardSize, std::uint32_t seed)
+        : Board{boardSize}
+        , mRandom{seed != 0 ? seed : 1}
+        , mTreat{this->cellIndex({2, 2})}
+    {
+        for (unsigned int y = 0; y < 3; ++y) {
+            pushHead(this->cellIndex({boardSize / 2, y}));
+        }
+    }
+
+    explicit RingGame(const Game& game, std::uint32_t seed)
+        : Board{game.boardSize()}
+        , mLength{static_cast<std::uint32_t>(game.body().size())}
+        , mRandom{seed != 0 ? seed : 1}
+        , mTreat{this->cellIndex(game.treat())}
+        , mDirection{game.direction()}
+        , mNextDirection{game.direction()}
+        , mSkipTailMove{game.skipTailMove()}
+    {
+        // ring positions grow towards the head
+        const auto& body {game.body()};
+        mHead = mLength - 1;
+        for (std::uint32_t i = 0; i < mLength; ++i) {
+            const auto cell {this->cellIndex(body.cell(i))};
+            mRing[mHead - i] = cell;
+            Board::occupy(mOccupied, cell);
+        }
+    }
+
+    inline bool setNextDirection(Direction direction) {
+        if (isOpposite(direction, mDirection)) {
+            return false;
+        }
+        mNextDirection = direction;
+        return true;
+    }
+
+    Outcome move() {
+        mDirection = mNextDirection;
+
+        const auto nextHead {this->neighbour(head(), mDirection)};
+
+        if (nextHead == mTreat) {
+            // right after another treat the tail still owes that one its growth
+            if (!mSkipTailMove) {
+                popTail();
+            }
+            mSkipTailMove = true;
+            pushHead(nextHead);
+
+            if (mLength + 1 >= this->area()) {
+                return Outcome::Won;
+            }
+
+            do {
+                mTreat = static_cast<Cell>(random() % this->area());
+            } while (isOccupied(mTreat));
+
+            return Outcome::Ate;
+        }
+
+        if (mSkipTailMove) {
+            mSkipTailMove = false;
+        } else {
+            popTail();
+        }
+
+        if (isOccupied(nextHead)) {
+            return Outcome::Lost;
+        }
+
+        pushHead(nextHead);
+
+        return Outcome::Moved;
+    }
+
+    /// Random number from the state itself, so clones replay the same treats
+    inline std::uint32_t random() {
+        // xorshift32
+        mRandom ^= mRandom << 13;
+        mRandom ^= mRandom >> 17;
+        mRandom ^= mRandom << 5;
+        return mRandom;
+    }
+    inline void reseed(std::uint32_t seed) {
+        mRandom = seed != 0 ? seed : 1;
+    }
+
+    inline std::uint32_t length() const {
+        return mLength;
+    }
+    /// `index` 0 is the head
+    inline Cell segment(std::uint32_t index) const {
+        return mRing[(mHead - index) & (capacity - 1)];
+    }
+    inline Cell head() const {
+        return mRing[mHead];
+    }
+    inline Cell tail() const {
+        return segment(mLength - 1);
+    }
+    inline Cell treat() const {
+        return mTreat;
+    }
+    inline Direction direction() const {
+        return mDirection;
+    }
+    inline bool skipTailMove() const {
+        return mSkipTailMove;
+    }
+    inline bool isOccupied(Cell cell) const {
+        return Board::isOccupied(mOccupied, cell);
+    }
+    /// Bit `y * boardSize + x` is set for every cell of the body
+    inline const Occupancy& occupancy() const {
+        return mOccupied;
+    }
+
+private:
+    inline void pushHead(Cell cell) {
+        mHead = (mHead + 1) & (capacity - 1);
+        mRing[mHead] = cell;
+        ++mLength;
+        Board::occupy(mOccupied, cell);
+    }
+    inline void popTail() {
+        Board::vacate(mOccupied, tail());
+        --mLength;
+    }
+
+private:
+    std::array<Cell, capacity> mRing {};
+    Occupancy mOccupied {};
+
+    std::uint32_t mHead {0};
+    std::uint32_t mLength {0};
+    std::uint32_t mRandom {1};
+
+    Cell mTreat {0};
+    Direction mDirection {Direction::Up};
+    Direction mNextDirection {Direction::Up};
+    bool mSkipTailMove {false};
+};
+
+}
@@ -0,0 +1,179 @@
+#include "StateRing.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace app::engine {
+
+namespace {
+
+constexpr std::uint32_t ringMagic {0x524B4E53}; // "SNKR"
+constexpr std::uint32_t ringVersion {2};
+
+std::int64_t nanoseconds(StateRing::Clock::duration duration) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+}
+
+//region Constructor & Destructor
+
+StateRing::StateRing(util::SharedMemory memory)
+    : mMemory{std::move(memory)}
+{}
+
+std::shared_ptr<StateRing> StateRing::create(const std::string& name, unsigned int boardSize) {
+    if (boardSize < 3) {
+        throw std::runtime_error{"Board is too small"};
+    }
+
+    const auto bytes {slotBytes(boardSize)};
+    std::shared_ptr<StateRing> ring {new StateRing{util::SharedMemory::create(name, slotsOffset + bytes * slotCount)}};
+
+    // the object starts zeroed, slots with sequence 0 and nothing published
+    auto& header {*reinterpret_cast<Header*>(ring->mMemory.data().data())};
+    header.magic = ringMagic;
+    header.version = ringVersion;
+    header.boardSize = boardSize;
+    header.slotCount = slotCount;
+    header.slotBytes = bytes;
+
+    return ring;
+}
+
+std::shared_ptr<const StateRing> StateRing::open(const std::string& name) {
+    std::shared_ptr<StateRing> ring {new StateRing{util::SharedMemory::open(name)}};
+
+    const auto size {ring->mMemory.data().size()};
+    const auto& header {ring->header()};
+    if (size < slotsOffset || header.magic != ringMagic || header.version != ringVersion || header.slotCount != slotCount) {
+        throw std::runtime_error{"Not a state ring " + name};
+    }
+    if (header.boardSize < 3 || header.slotBytes != slotBytes(header.boardSize) || size < slotsOffset + header.slotBytes * slotCount) {
+        throw std::runtime_error{"Truncated state ring " + name};
+    }
+
+    return ring;
+}
+
+//endregion
+
+//region Public Methods
+
+void StateRing::publish(const Game& game, const glm::mat4& camera, Clock::time_point movedAt, Clock::duration moveInterval) {
+    if (game.boardSize() != boardSize()) {
+        throw std::runtime_error{"Game is for another board"};
+    }
+
+    auto& header {*reinterpret_cast<Header*>(mMemory.data().data())};
+    const auto version {header.published.load(std::memory_order_relaxed)};
+    auto& target {slot(version % slotCount)};
+
+    // odd until the slot is whole again, readers that started on it see the change
+    const auto sequence {target.sequence.load(std::memory_order_relaxed)};
+    target.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    const auto& body {game.body()};
+    const auto size {boardSize()};
+
+    target.version = version;
+    target.publishedAt = nanoseconds(Clock::now().time_since_epoch());
+    target.movedAt = nanoseconds(movedAt.time_since_epoch());
+    target.moveInterval = nanoseconds(moveInterval);
+    std::memcpy(target.camera, &camera[0][0], sizeof(target.camera));
+    target.length = static_cast<std::uint32_t>(body.size());
+    target.treat = game.treat().y * size + game.treat().x;
+    target.state = static_cast<std::uint8_t>(game.state());
+    target.skipTailMove = game.skipTailMove() ? 1 : 0;
+
+    auto* cells {reinterpret_cast<std::uint32_t*>(&target + 1)};
+    auto* directions {reinterpret_cast<std::uint64_t*>(reinterpret_cast<std::byte*>(&target + 1) + directionsOffset(size))};
+    std::uint64_t word {0};
+    for (size_t segment = 0; segment < body.size(); ++segment) {
+        const auto cell {body.cell(segment)};
+        cells[segment] = cell.y * size + cell.x;
+
+        word |= static_cast<std::uint64_t>(body.direction(segment)) << (segment % 32 * 2);
+        if (segment % 32 == 31 || segment + 1 == body.size()) {
+            directions[segment / 32] = word;
+            word = 0;
+        }
+    }
+
+    target.sequence.store(sequence + 2, std::memory_order_release);
+    header.published.store(version + 1, std::memory_order_release);
+
+    // readers map the ring read-only and cannot say whether they sleep, one wake per move costs little
+    header.wakeup.store(static_cast<std::uint32_t>(version + 1), std::memory_order_release);
+#if defined(__linux__)
+    ::syscall(SYS_futex, &header.wakeup, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+bool StateRing::waitPublished(std::uint64_t seen, Clock::duration timeout) const {
+    if (published() != seen) {
+        return true;
+    }
+
+#if defined(__linux__)
+    // a publish after the check changes the word, the kernel returns at once then
+    const auto wait {std::max<std::int64_t>(0, nanoseconds(timeout))};
+    const timespec relative {static_cast<time_t>(wait / 1'000'000'000), static_cast<long>(wait % 1'000'000'000)};
+    ::syscall(SYS_futex, &header().wakeup, FUTEX_WAIT, static_cast<std::uint32_t>(seen), &relative, nullptr, 0);
+#else
+    std::this_thread::sleep_for(std::min<Clock::duration>(timeout, std::chrono::milliseconds{1}));
+#endif
+
+    return published() != seen;
+}
+
+glm::mat4 StateRing::Snapshot::camera() const {
+    glm::mat4 camera {};
+    std::memcpy(&camera[0][0], mSlot->camera, sizeof(mSlot->camera));
+    return camera;
+}
+
+//endregion
+
+//region Private Methods
+
+std::optional<StateRing::Snapshot> StateRing::snapshot(std::uint64_t index) const {
+    const auto& source {slot(index)};
+    const auto sequence {source.sequence.load(std::memory_order_acquire)};
+    if (sequence % 2 != 0) {
+        return std::nullopt;
+    }
+
+    return Snapshot{&source, sequence, boardSize()};
+}
+
+size_t StateRing::slotBytes(unsigned int boardSize) {
+    const auto capacity {static_cast<size_t>(boardSize) * boardSize};
+    const auto bytes {sizeof(Slot) + directionsOffset(boardSize) + (capacity + 31) / 32 * sizeof(std::uint64_t)};
+
+    // slots on their own cache lines
+    return (bytes + 63) / 64 * 64;
+}
+
+StateRing::Snapshot::Snapshot(const Slot* slot, std::uint64_t sequence, unsigned int boardSize)
+    : mSlot{slot}
+    , mCells{reinterpret_cast<const std::uint32_t*>(slot + 1)}
+    , mDirections{reinterpret_cast<const std::uint64_t*>(reinterpret_cast<const std::byte*>(slot + 1) + directionsOffset(boardSize))}
+    , mSequence{sequence}
+    , mBoardSize{boardSize}
+    // a torn length never reads past the slot
+    , mSize{std::min<size_t>(slot->length, static_cast<size_t>(boardSize) * boardSize)}
+{}
+
+//endregion
+
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <engine/Game.hpp>
+#include <util/SharedMemory.hpp>
+#include <glm/mat4x4.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace app::engine {
+
+/**
+ * Game states a simulation process publishes for renderers in other processes, in a ring of slots
+ * in POSIX shared memory. Every slot has a sequence number that is odd while the publisher writes it,
+ * so nobody locks: readers read a slot in place and keep what they read only when the sequence
+ * did not change meanwhile. Each publish takes the next slot, a reader of the latest one races the
+ * publisher only after `slotCount - 1` more publishes.
+ */
+class StateRing {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr std::uint32_t slotCount {4};
+
+    class Snapshot;
+
+    /// The publishing side, `name` is a shared-memory name such as "/snake", removed again on destruction
+    static std::shared_ptr<StateRing> create(const std::string& name, unsigned int boardSize);
+    /// A reading side of the ring another process created, throws when there is none
+    static std::shared_ptr<const StateRing> open(const std::string& name);
+
+    StateRing(const StateRing&) = delete;
+    StateRing & operator=(const StateRing&) = delete;
+
+    /// The game with the camera, and the last move with its duration so renderers glide the body the same way
+    void publish(const Game& game, const glm::mat4& camera, Clock::time_point movedAt, Clock::duration moveInterval);
+
+    inline unsigned int boardSize() const {
+        return header().boardSize;
+    }
+    /// Grows by one with every publish
+    inline std::uint64_t published() const {
+        return header().published.load(std::memory_order_acquire);
+    }
+    /// Sleeps until a publish after `seen` or for `timeout`, true when there is a newer state. May return early
+    bool waitPublished(std::uint64_t seen, Clock::duration timeout) const;
+
+    /**
+     * `read(snapshot)` on the latest state in place, again on a newer one when it was overwritten meanwhile,
+     * so `read` must not keep anything before it returns. False before the first publish.
+     */
+    template<typename Read>
+    bool read(Read&& read) const;
+
+private:
+    struct Header {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint32_t boardSize;
+        std::uint32_t slotCount;
+        std::uint64_t slotBytes;
+        std::atomic<std::uint64_t> published;
+        // the low half of `published`, the word readers sleep on
+        std::atomic<std::uint32_t> wakeup;
+    };
+
+    // followed by a cell index per segment, head first, and 2-bit directions in the layout of `Body`
+    struct Slot {
+        std::atomic<std::uint64_t> sequence;
+        std::uint64_t version;
+        // steady clock nanoseconds, the same monotonic clock in every process
+        std::int64_t publishedAt;
+        std::int64_t movedAt;
+        std::int64_t moveInterval;
+        float camera[16];
+        std::uint32_t length;
+        std::uint32_t treat;
+        std::uint8_t state;
+        std::uint8_t skipTailMove;
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Sequences are shared between processes");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free && sizeof(std::atomic<std::uint32_t>) == 4, "Readers sleep on the wakeup word");
+
+    explicit StateRing(util::SharedMemory memory);
+
+    inline const Header& header() const {
+        return *reinterpret_cast<const Header*>(mMemory.data().data());
+    }
+    inline Slot& slot(std::uint64_t index) const {
+        return *reinterpret_cast<Slot*>(mMemory.data().data() + slotsOffset + index * header().slotBytes);
+    }
+    /// `std::nullopt` while the slot is being written
+    std::optional<Snapshot> snapshot(std::uint64_t index) const;
+
+    static constexpr size_t slotsOffset {64};
+    static_assert(sizeof(Header) <= slotsOffset);
+    static size_t slotBytes(unsigned int boardSize);
+    /// After the fixed part of a slot, past the cells
+    static inline size_t directionsOffset(unsigned int boardSize) {
+        return (static_cast<size_t>(boardSize) * boardSize * sizeof(std::uint32_t) + 7) / 8 * 8;
+    }
+
+private:
+    util::SharedMemory mMemory;
+};
+
+/// One published state read in place, with the accessors of `Body` for the segments
+class StateRing::Snapshot {
+public:
+    using Segment = Body::Segment;
+
+    inline size_t size() const {
+        return mSize;
+    }
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+    inline glm::uvec2 cell(size_t index) const {
+        const auto packed {mCells[index]};
+        return {packed % mBoardSize, packed / mBoardSize};
+    }
+    inline Direction direction(size_t index) const {
+        return static_cast<Direction>((mDirections[index / 32] >> (index % 32 * 2)) & 3);
+    }
+    inline Segment front() const {
+        return {cell(0), direction(0)};
+    }
+
+    inline glm::uvec2 treat() const {
+        return {mSlot->treat % mBoardSize, mSlot->treat / mBoardSize % mBoardSize};
+    }
+    inline GameState state() const {
+        return static_cast<GameState>(mSlot->state & 3);
+    }
+    inline bool skipTailMove() const {
+        return mSlot->skipTailMove != 0;
+    }
+    glm::mat4 camera() const;
+    inline Clock::time_point publishedAt() const {
+        return Clock::time_point{std::chrono::nanoseconds{mSlot->publishedAt}};
+    }
+    inline Clock::time_point movedAt() const {
+        return Clock::time_point{std::chrono::nanoseconds{mSlot->movedAt}};
+    }
+    inline Clock::duration moveInterval() const {
+        return std::chrono::nanoseconds{mSlot->moveInterval};
+    }
+    inline std::uint64_t version() const {
+        return mSlot->version;
+    }
+
+    /// False once the publisher began overwriting the slot, whatever was read from it is void then
+    inline bool valid() const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return mSlot->sequence.load(std::memory_order_relaxed) == mSequence;
+    }
+
+private:
+    friend class StateRing;
+
+    Snapshot(const Slot* slot, std::uint64_t sequence, unsigned int boardSize);
+
+private:
+    const Slot* mSlot;
+    const std::uint32_t* mCells;
+    const std::uint64_t* mDirections;
+    std::uint64_t mSequence;
+    unsigned int mBoardSize;
+    size_t mSize;
+};
+
+template<typename Read>
+bool StateRing::read(Read&& read) const {
+    for (;;) {
+        const auto version {published()};
+        if (version == 0) {
+            return false;
+        }
+
+        if (const auto latest {snapshot((version - 1) % slotCount)}; latest.has_value()) {
+            read(*latest);
+            if (latest->valid()) {
+                return true;
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,195 @@
+#include "TimerWheel.hpp"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace app::engine {
+
+//region Constructor & Destructor
+
+TimerWheel::TimerWheel(Clock::duration resolution, Clock::time_point start)
+    : mResolution{resolution}
+    , mStart{start}
+{
+    if (resolution <= Clock::duration::zero()) {
+        throw std::runtime_error{"Invalid timer wheel resolution"};
+    }
+
+    mHeads.fill(none);
+}
+
+//endregion
+
+//region Public Methods
+
+TimerWheel::TimerId TimerWheel::add(Clock::time_point deadline, std::uint64_t data) {
+    TimerId id {};
+    if (mFree.empty()) {
+        id = static_cast<TimerId>(mTimers.size());
+        mTimers.emplace_back();
+    } else {
+        id = mFree.back();
+        mFree.pop_back();
+    }
+
+    auto& timer {mTimers[id]};
+    timer.deadline = deadline;
+    timer.data = data;
+    timer.tick = toTickRoundingUp(deadline);
+    timer.slot = notScheduled;
+
+    insert(id);
+    ++mSize;
+
+    return id;
+}
+
+void TimerWheel::reschedule(TimerId id, Clock::time_point deadline) {
+    auto& timer {mTimers[id]};
+
+    if (timer.slot != notScheduled) {
+        unlink(id);
+    }
+
+    timer.deadline = deadline;
+    timer.tick = toTickRoundingUp(deadline);
+
+    insert(id);
+}
+
+void TimerWheel::remove(TimerId id) {
+    if (mTimers[id].slot != notScheduled) {
+        unlink(id);
+    }
+
+    mFree.push_back(id);
+    --mSize;
+}
+
+std::optional<TimerWheel::Clock::time_point> TimerWheel::nextDeadline() const {
+    const auto tick {nextTick()};
+
+    return tick.has_value() ? std::optional{toTime(*tick)} : std::nullopt;
+}
+
+//endregion
+
+//region Private Methods
+
+std::uint64_t TimerWheel::toTick(Clock::time_point time) const {
+    return time <= mStart ? 0 : static_cast<std::uint64_t>((time - mStart) / mResolution);
+}
+
+std::uint64_t TimerWheel::toTickRoundingUp(Clock::time_point time) const {
+    return time <= mStart ? 0 : toTick(time - Clock::duration{1}) + 1;
+}
+
+TimerWheel::Clock::time_point TimerWheel::toTime(std::uint64_t tick) const {
+    return mStart + mResolution * tick;
+}
+
+void TimerWheel::insert(TimerId id) {
+    auto& timer {mTimers[id]};
+    const auto tick {std::max(timer.tick, mCurrent)};
+
+    // the lowest level where the tick shares all higher digits with the current tick
+    unsigned int slot {overflowSlot};
+    for (unsigned int level = 0; level < levels; ++level) {
+        if (((tick ^ mCurrent) >> ((level + 1) * slotBits)) == 0) {
+            slot = level * slots + ((tick >> (level * slotBits)) & (slots - 1));
+            break;
+        }
+    }
+
+    timer.slot = static_cast<std::uint16_t>(slot);
+    timer.previous = none;
+    timer.next = mHeads[slot];
+    if (timer.next != none) {
+        mTimers[timer.next].previous = id;
+    }
+    mHeads[slot] = id;
+
+    if (slot != overflowSlot) {
+        mOccupied[slot / slots] |= std::uint64_t{1} << (slot % slots);
+    }
+}
+
+void TimerWheel::unlink(TimerId id) {
+    auto& timer {mTimers[id]};
+
+    if (timer.previous != none) {
+        mTimers[timer.previous].next = timer.next;
+    } else {
+        mHeads[timer.slot] = timer.next;
+    }
+    if (timer.next != none) {
+        mTimers[timer.next].previous = timer.previous;
+    }
+
+    if (timer.slot != overflowSlot && mHeads[timer.slot] == none) {
+        mOccupied[timer.slot / slots] &= ~(std::uint64_t{1} << (timer.slot % slots));
+    }
+
+    timer.slot = notScheduled;
+}
+
+TimerWheel::TimerId TimerWheel::popSlot(unsigned int slot) {
+    const auto id {mHeads[slot]};
+    if (id != none) {
+        unlink(id);
+    }
+
+    return id;
+}
+
+void TimerWheel::cascade(unsigned int slot) {
+    // detach first, overflow timers may go back to the same slot
+    TimerId id {std::exchange(mHeads[slot], none)};
+    if (slot != overflowSlot) {
+        mOccupied[slot / slots] &= ~(std::uint64_t{1} << (slot % slots));
+    }
+
+    while (id != none) {
+        const auto next {mTimers[id].next};
+        insert(id);
+        id = next;
+    }
+}
+
+void TimerWheel::advance(std::uint64_t tick) {
+    mCurrent = tick;
+
+    if ((mCurrent & ((std::uint64_t{1} << (levels * slotBits)) - 1)) == 0) {
+        cascade(overflowSlot);
+    }
+    for (unsigned int level = levels - 1; level > 0; --level) {
+        if ((mCurrent & ((std::uint64_t{1} << (level * slotBits)) - 1)) == 0) {
+            cascade(level * slots + ((mCurrent >> (level * slotBits)) & (slots - 1)));
+        }
+    }
+}
+
+std::optional<std::uint64_t> TimerWheel::nextTick() const {
+    for (unsigned int level = 0; level < levels; ++level) {
+        if (mOccupied[level] == 0) {
+            continue;
+        }
+
+        const unsigned int shift {level * slotBits};
+        const auto upper {(mCurrent >> (shift + slotBits)) << (shift + slotBits)};
+
+        return upper | (static_cast<std::uint64_t>(std::countr_zero(mOccupied[level])) << shift);
+    }
+
+    if (mHeads[overflowSlot] != none) {
+        constexpr unsigned int span {levels * slotBits};
+        return ((mCurrent >> span) + 1) << span;
+    }
+
+    return std::nullopt;
+}
+
+//endregion
+
+}
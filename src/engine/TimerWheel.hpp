@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace app::engine {
+
+/**
+ * Hierarchical timing wheel: 4 levels of 64 slots, insert/reschedule/remove in O(1),
+ * the earliest deadline is found with a bit scan per level.
+ * Deadlines are rounded up to the resolution, the ones beyond 64^4 ticks wait in an overflow list.
+ */
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = std::uint32_t;
+
+    explicit TimerWheel(
+        Clock::duration resolution = std::chrono::microseconds{100},
+        Clock::time_point start = Clock::now()
+    );
+
+    TimerId add(Clock::time_point deadline, std::uint64_t data = 0);
+    void reschedule(TimerId id, Clock::time_point deadline);
+    void remove(TimerId id);
+
+    /// When `expire()` has something to do: the earliest deadline or a cascade of a higher level
+    std::optional<Clock::time_point> nextDeadline() const;
+
+    /// Calls `callback(id, data)` for every timer due by `now`, the callback may add, reschedule or remove timers
+    template<typename Callback>
+    void expire(Clock::time_point now, Callback&& callback);
+
+    inline size_t size() const {
+        return mSize;
+    }
+
+private:
+    static constexpr unsigned int levels {4};
+    static constexpr unsigned int slotBits {6};
+    static constexpr unsigned int slots {1u << slotBits};
+    static constexpr unsigned int overflowSlot {levels * slots};
+    static constexpr std::uint32_t none {~std::uint32_t{0}};
+
+    struct Timer {
+        Clock::time_point deadline;
+        std::uint64_t data;
+        std::uint64_t tick;
+        std::uint32_t previous;
+        std::uint32_t next;
+        std::uint16_t slot; // level * slots + index, `notScheduled` after it fired
+    };
+    static constexpr std::uint16_t notScheduled {0xFFFF};
+
+    std::uint64_t toTick(Clock::time_point time) const;
+    std::uint64_t toTickRoundingUp(Clock::time_point time) const;
+    Clock::time_point toTime(std::uint64_t tick) const;
+    void insert(TimerId id);
+    void unlink(TimerId id);
+    TimerId popSlot(unsigned int slot);
+    void cascade(unsigned int slot);
+    void advance(std::uint64_t tick);
+    std::optional<std::uint64_t> nextTick() const;
+
+private:
+    Clock::duration mResolution;
+    Clock::time_point mStart;
+    std::uint64_t mCurrent {0};
+    size_t mSize {0};
+
+    std::vector<Timer> mTimers;
+    std::vector<TimerId> mFree;
+    std::array<std::uint32_t, levels * slots + 1> mHeads;
+    std::array<std::uint64_t, levels> mOccupied {};
+};
+
+template<typename Callback>
+void TimerWheel::expire(Clock::time_point now, Callback&& callback) {
+    const auto target {toTick(now)};
+
+    while (true) {
+        const unsigned int slot {static_cast<unsigned int>(mCurrent & (slots - 1))};
+
+        for (TimerId id {popSlot(slot)}; id != none; id = popSlot(slot)) {
+            callback(id, mTimers[id].data);
+        }
+
+        if (mCurrent >= target) {
+            break;
+        }
+
+        // jump over empty slots, stopping only where something fires or cascades
+        advance(std::min(target, nextTick().value_or(target)));
+    }
+}
+
+}
@@ -0,0 +1,111 @@
+#include "TreatField.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace app::engine {
+
+//region Constructor & Destructor
+
+TreatField::TreatField(size_t capacity) {
+    reserve(capacity);
+}
+
+//endregion
+
+//region Public Methods
+
+const TreatField::Treat* TreatField::at(const glm::uvec2& cell) const {
+    const auto slot {mSlots[find(key(cell))]};
+
+    return slot == noTreat ? nullptr : &mTreats[slot];
+}
+
+bool TreatField::spawn(const glm::uvec2& cell, TreatKind kind) {
+    if ((mTreats.size() + 1) * 2 > mSlots.size()) {
+        reserve(mTreats.size() + 1);
+    }
+
+    const auto slot {find(key(cell))};
+    if (mSlots[slot] != noTreat) {
+        return false;
+    }
+
+    mSlots[slot] = static_cast<std::uint32_t>(mTreats.size());
+    mTreats.push_back({cell, kind});
+
+    return true;
+}
+
+bool TreatField::despawn(const glm::uvec2& cell) {
+    auto slot {find(key(cell))};
+    const auto index {mSlots[slot]};
+    if (index == noTreat) {
+        return false;
+    }
+
+    // shifts the following entries back instead of leaving a tombstone, so probes never grow longer
+    const auto mask {mSlots.size() - 1};
+    for (auto next {(slot + 1) & mask}; mSlots[next] != noTreat; next = (next + 1) & mask) {
+        const auto wanted {home(key(mTreats[mSlots[next]].cell))};
+        // moves unless `wanted` is cyclically in (slot, next]
+        if (((next - wanted) & mask) >= ((next - slot) & mask)) {
+            mSlots[slot] = mSlots[next];
+            slot = next;
+        }
+    }
+    mSlots[slot] = noTreat;
+
+    // the last treat takes its place
+    if (index + 1 != mTreats.size()) {
+        mTreats[index] = mTreats.back();
+        mSlots[find(key(mTreats[index].cell))] = index;
+    }
+    mTreats.pop_back();
+
+    return true;
+}
+
+void TreatField::clear() {
+    mTreats.clear();
+    std::ranges::fill(mSlots, noTreat);
+}
+
+void TreatField::reserve(size_t capacity) {
+    mTreats.reserve(capacity);
+
+    const auto slots {std::bit_ceil(std::max<size_t>(capacity * 2, 16))};
+    if (slots <= mSlots.size()) {
+        return;
+    }
+
+    mSlots.assign(slots, noTreat);
+    mShift = 64 - std::countr_zero(slots);
+
+    for (size_t index = 0; index < mTreats.size(); ++index) {
+        mSlots[find(key(mTreats[index].cell))] = static_cast<std::uint32_t>(index);
+    }
+}
+
+//endregion
+
+//region Private Methods
+
+size_t TreatField::find(std::uint64_t key) const {
+    const auto mask {mSlots.size() - 1};
+
+    auto slot {home(key)};
+    while (mSlots[slot] != noTreat && TreatField::key(mTreats[mSlots[slot]].cell) != key) {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+size_t TreatField::home(std::uint64_t key) const {
+    // Fibonacci hashing, neighbouring cells spread over the table
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> mShift);
+}
+
+//endregion
+
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <glm/vec2.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace app::engine {
+
+enum class TreatKind : std::uint8_t {Plain, Bonus, Rare};
+
+/**
+ * The treats on the board, any number of them at distinct cells. A small open-addressing table maps a cell to its
+ * treat, so looking one up, spawning and despawning take the same time with one treat or thousands, and its size
+ * follows the treats rather than the board. The treats themselves stay packed for drawing, in no particular order.
+ */
+class TreatField {
+public:
+    struct Treat {
+        glm::uvec2 cell;
+        TreatKind kind;
+    };
+
+    /// Room for `capacity` treats before spawning allocates
+    explicit TreatField(size_t capacity = 1);
+
+    TreatField(TreatField &&other) noexcept = default;
+    TreatField & operator=(TreatField &&other) noexcept = default;
+    ~TreatField() noexcept = default;
+
+    inline bool contains(const glm::uvec2& cell) const {
+        return mSlots[find(key(cell))] != noTreat;
+    }
+    /// Null without a treat at `cell`
+    const Treat* at(const glm::uvec2& cell) const;
+
+    /// False when there is a treat at `cell` already
+    bool spawn(const glm::uvec2& cell, TreatKind kind = TreatKind::Plain);
+    /// False without a treat at `cell`
+    bool despawn(const glm::uvec2& cell);
+    /// Keeps the capacity
+    void clear();
+    void reserve(size_t capacity);
+
+    inline size_t size() const {
+        return mTreats.size();
+    }
+    inline bool empty() const {
+        return mTreats.empty();
+    }
+    inline std::span<const Treat> treats() const {
+        return mTreats;
+    }
+    inline const Treat& operator[](size_t index) const {
+        return mTreats[index];
+    }
+
+private:
+    static constexpr std::uint32_t noTreat {~0u};
+
+    static inline std::uint64_t key(const glm::uvec2& cell) {
+        return (static_cast<std::uint64_t>(cell.y) << 32) | cell.x;
+    }
+
+    /// The slot holding `key`, or the free one ending its probe sequence
+    size_t find(std::uint64_t key) const;
+    size_t home(std::uint64_t key) const;
+
+private:
+    std::vector<Treat> mTreats;
+    // an index into `mTreats` per slot, at most half of them used
+    std::vector<std::uint32_t> mSlots;
+    unsigned int mShift {0};
+};
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <engine/Direction.hpp>
+#include <array>
+#include <chrono>
+#include <optional>
+
+namespace app::engine {
+
+/**
+ * Turns typed ahead of the moves, every move takes one. Each turn is checked against the turn queued before it,
+ * so a quick "up, left" between two moves keeps both instead of the second one overwriting the first.
+ */
+class TurnQueue {
+public:
+    static constexpr size_t capacity {4};
+
+    struct Turn {
+        Direction direction;
+        /// When the key was pressed, for latency measurements
+        std::chrono::steady_clock::time_point time;
+    };
+
+    /// False when full, or when `direction` repeats or reverses the last queued turn (`current` when none is queued)
+    inline bool push(Direction direction, Direction current, std::chrono::steady_clock::time_point time = {}) {
+        const auto last {mSize > 0 ? mTurns[(mFront + mSize - 1) % capacity].direction : current};
+        if (mSize == capacity || direction == last || isOpposite(direction, last)) {
+            return false;
+        }
+
+        mTurns[(mFront + mSize) % capacity] = {direction, time};
+        ++mSize;
+
+        return true;
+    }
+
+    inline std::optional<Turn> pop() {
+        if (mSize == 0) {
+            return std::nullopt;
+        }
+
+        const auto turn {mTurns[mFront]};
+        mFront = (mFront + 1) % capacity;
+        --mSize;
+
+        return turn;
+    }
+
+    inline void clear() {
+        mSize = 0;
+    }
+    inline size_t size() const {
+        return mSize;
+    }
+    inline bool empty() const {
+        return mSize == 0;
+    }
+
+private:
+    std::array<Turn, capacity> mTurns {};
+    size_t mFront {0};
+    size_t mSize {0};
+};
+
+}
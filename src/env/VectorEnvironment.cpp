@@ -0,0 +1,143 @@
+#include "VectorEnvironment.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace app::env {
+
+namespace {
+
+inline void setBit(std::uint64_t* plane, size_t bit) {
+    plane[bit / 64] |= std::uint64_t{1} << (bit % 64);
+}
+
+template<typename State>
+void copyBody(const State& game, std::uint64_t* plane, size_t words) {
+    if constexpr (requires { game.occupancy().data(); }) {
+        std::copy_n(game.occupancy().begin(), words, plane);
+    } else {
+        // std::bitset has no word access, the body is short next to the board anyway
+        std::fill_n(plane, words, 0);
+        for (std::uint32_t i = 0; i < game.length(); ++i) {
+            setBit(plane, game.segment(i));
+        }
+    }
+}
+
+}
+
+//region Constructor & Destructor
+
+VectorEnvironment::VectorEnvironment(size_t count, unsigned int boardSize)
+    : mBoardSize{boardSize}
+    , mPlaneWords{(static_cast<size_t>(boardSize) * boardSize + 63) / 64}
+    , mGames{engine::withEngine<Fallback>(boardSize, [count](auto state) -> Games {
+        return std::vector<typename decltype(state)::type>(count);
+    })}
+    , mSeeds(count)
+    , mEpisodes(count)
+{
+    if (count == 0) {
+        throw std::runtime_error{"No environments"};
+    }
+    if (boardSize < 3) {
+        throw std::runtime_error{"Board is too small"};
+    }
+    if (boardSize > Fallback::maxBoardSize) {
+        throw std::runtime_error{"Board is too large"};
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+void VectorEnvironment::reset(std::uint64_t seed, std::span<std::uint64_t> observations) {
+    if (observations.size() < size() * observationWords()) {
+        throw std::runtime_error{"Observation buffer is too small"};
+    }
+
+    std::visit([&](auto& games) {
+        for (size_t i = 0; i < size(); ++i) {
+            mSeeds[i] = seed + i;
+            mEpisodes[i] = 0;
+            restart(games, i);
+            observe(games, i, observations);
+        }
+    }, mGames);
+}
+
+void VectorEnvironment::step(
+    std::span<const std::uint8_t> actions,
+    std::span<std::uint64_t> observations,
+    std::span<float> rewards,
+    std::span<std::uint8_t> dones
+) {
+    if (actions.size() < size() || rewards.size() < size() || dones.size() < size()) {
+        throw std::runtime_error{"Buffer is too small"};
+    }
+    if (observations.size() < size() * observationWords()) {
+        throw std::runtime_error{"Observation buffer is too small"};
+    }
+
+    std::visit([&](auto& games) {
+        for (size_t i = 0; i < size(); ++i) {
+            auto& game {games[i]};
+
+            if (actions[i] <= static_cast<std::uint8_t>(engine::Direction::Right)) {
+                game.setNextDirection(static_cast<engine::Direction>(actions[i]));
+            }
+
+            switch (game.move()) {
+                case engine::Outcome::Moved:
+                    rewards[i] = 0.0f;
+                    dones[i] = 0;
+                    break;
+                case engine::Outcome::Ate:
+                    rewards[i] = 1.0f;
+                    dones[i] = 0;
+                    break;
+                case engine::Outcome::Won:
+                    rewards[i] = 1.0f;
+                    dones[i] = 1;
+                    restart(games, i);
+                    break;
+                case engine::Outcome::Lost:
+                    rewards[i] = -1.0f;
+                    dones[i] = 1;
+                    restart(games, i);
+                    break;
+            }
+
+            observe(games, i, observations);
+        }
+    }, mGames);
+}
+
+//endregion
+
+//region Private Methods
+
+template<typename State>
+void VectorEnvironment::restart(std::vector<State>& games, size_t index) {
+    // a new seed per episode, still reproducible from the reset seed
+    const auto seed {mSeeds[index] * 0x9E3779B97F4A7C15ull + mEpisodes[index]++};
+
+    games[index] = State{mBoardSize, static_cast<std::uint32_t>(seed ^ (seed >> 32))};
+}
+
+template<typename State>
+void VectorEnvironment::observe(const std::vector<State>& games, size_t index, std::span<std::uint64_t> observations) const {
+    const auto& game {games[index]};
+    auto* body {observations.data() + index * observationWords()};
+    auto* head {body + mPlaneWords};
+    auto* treat {head + mPlaneWords};
+
+    copyBody(game, body, mPlaneWords);
+    std::fill_n(head, 2 * mPlaneWords, 0);
+    setBit(head, game.head());
+    setBit(treat, game.treat());
+}
+
+//endregion
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <engine/CompactGame.hpp>
+#include <engine/Engine.hpp>
+#include <cstdint>
+#include <span>
+#include <variant>
+#include <vector>
+
+namespace app::env {
+
+/**
+ * N independent games stepped together, for reinforcement learning. All memory is allocated up front:
+ * `reset()` and `step()` only write the caller buffers, finished games restart in place.
+ * Common board sizes step a fixed-size `engine::Engine`, the others a `CompactGame`, both with a single treat.
+ */
+class VectorEnvironment {
+public:
+    using Fallback = engine::CompactGame<64>;
+
+    explicit VectorEnvironment(size_t count, unsigned int boardSize);
+
+    VectorEnvironment(VectorEnvironment &&other) noexcept = default;
+    VectorEnvironment & operator=(VectorEnvironment &&other) noexcept = default;
+    ~VectorEnvironment() noexcept = default;
+
+    void reset(std::uint64_t seed, std::span<std::uint64_t> observations);
+    void step(
+        std::span<const std::uint8_t> actions,
+        std::span<std::uint64_t> observations,
+        std::span<float> rewards,
+        std::span<std::uint8_t> dones
+    );
+
+    inline size_t size() const {
+        return mSeeds.size();
+    }
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+    /// 64-bit words of one bit-plane
+    inline size_t planeWords() const {
+        return mPlaneWords;
+    }
+    /// 64-bit words of one environment observation: body, head and treat planes
+    inline size_t observationWords() const {
+        return 3 * mPlaneWords;
+    }
+
+private:
+    template<typename State>
+    void restart(std::vector<State>& games, size_t index);
+    template<typename State>
+    void observe(const std::vector<State>& games, size_t index, std::span<std::uint64_t> observations) const;
+
+private:
+    // one alternative per size of `engine::withEngine`
+    using Games = std::variant<
+        std::vector<engine::Engine<8, 8>>,
+        std::vector<engine::Engine<13, 13>>,
+        std::vector<engine::Engine<16, 16>>,
+        std::vector<engine::Engine<32, 32>>,
+        std::vector<engine::Engine<64, 64>>,
+        std::vector<Fallback>
+    >;
+
+    unsigned int mBoardSize;
+    size_t mPlaneWords;
+    Games mGames;
+    std::vector<std::uint64_t> mSeeds;
+    std::vector<std::uint32_t> mEpisodes;
+};
+
+}
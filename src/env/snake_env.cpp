@@ -0,0 +1,59 @@
+#include "snake_env.h"
+#include <env/VectorEnvironment.hpp>
+#include <exception>
+
+struct snake_env {
+    app::env::VectorEnvironment environment;
+};
+
+extern "C" {
+
+snake_env* snake_env_create(size_t count, unsigned int board_size) {
+    try {
+        return new snake_env{app::env::VectorEnvironment{count, board_size}};
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+void snake_env_destroy(snake_env* env) {
+    delete env;
+}
+
+size_t snake_env_count(const snake_env* env) {
+    return env != nullptr ? env->environment.size() : 0;
+}
+
+size_t snake_env_observation_size(const snake_env* env) {
+    return env != nullptr ? env->environment.observationWords() * sizeof(uint64_t) : 0;
+}
+
+int snake_env_reset(snake_env* env, uint64_t seed, uint64_t* observations) {
+    if (env == nullptr || observations == nullptr) {
+        return -1;
+    }
+
+    auto& environment {env->environment};
+    environment.reset(seed, {observations, environment.size() * environment.observationWords()});
+
+    return 0;
+}
+
+int snake_env_step(snake_env* env, const uint8_t* actions, uint64_t* observations, float* rewards, uint8_t* dones) {
+    if (env == nullptr || actions == nullptr || observations == nullptr || rewards == nullptr || dones == nullptr) {
+        return -1;
+    }
+
+    auto& environment {env->environment};
+    const auto count {environment.size()};
+    environment.step(
+        {actions, count},
+        {observations, count * environment.observationWords()},
+        {rewards, count},
+        {dones, count}
+    );
+
+    return 0;
+}
+
+}
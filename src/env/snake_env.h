@@ -0,0 +1,59 @@
+/*
+ * C interface of the vectorized environment, for training agents from any language.
+ *
+ * Every call works on all environments at once. Observations are written into a caller buffer of
+ * `count * snake_env_observation_size()` bytes: per environment three bit-planes (body, head, treat),
+ * each `ceil(board_size^2 / 64)` native 64-bit words, bit `y * board_size + x` per cell.
+ *
+ * Functions returning int give 0 on success and -1 on invalid arguments.
+ */
+#ifndef SNAKE_ENV_H
+#define SNAKE_ENV_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+    #define SNAKE_ENV_API __declspec(dllexport)
+#else
+    #define SNAKE_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct snake_env snake_env;
+
+/* Actions are absolute directions, a reversal keeps the current one */
+enum snake_env_action {
+    SNAKE_ENV_UP = 0,
+    SNAKE_ENV_DOWN = 1,
+    SNAKE_ENV_LEFT = 2,
+    SNAKE_ENV_RIGHT = 3
+};
+
+/* NULL when the board size is outside [3, 64] or count is 0 */
+SNAKE_ENV_API snake_env* snake_env_create(size_t count, unsigned int board_size);
+SNAKE_ENV_API void snake_env_destroy(snake_env* env);
+
+SNAKE_ENV_API size_t snake_env_count(const snake_env* env);
+/* Bytes of one environment observation */
+SNAKE_ENV_API size_t snake_env_observation_size(const snake_env* env);
+
+/* Environment i starts from seed + i */
+SNAKE_ENV_API int snake_env_reset(snake_env* env, uint64_t seed, uint64_t* observations);
+
+/*
+ * Reward is +1 for a treat, -1 for a bump and 0 otherwise. A finished environment (bump or full board)
+ * sets its done flag and starts over right away, its observation is the first one of the new game.
+ */
+SNAKE_ENV_API int snake_env_step(
+    snake_env* env, const uint8_t* actions, uint64_t* observations, float* rewards, uint8_t* dones
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+#include "Input.hpp"
+#include <GLFW/glfw3.h>
+#include <stdexcept>
+
+namespace app::input {
+
+static_assert(GLFW_KEY_LAST < KeyBindings::size);
+
+//region KeyBindings
+
+KeyBindings KeyBindings::defaults() {
+    KeyBindings bindings {};
+
+    bindings.bind(GLFW_KEY_UP, Action::Up);
+    bindings.bind(GLFW_KEY_DOWN, Action::Down);
+    bindings.bind(GLFW_KEY_LEFT, Action::Left);
+    bindings.bind(GLFW_KEY_RIGHT, Action::Right);
+    bindings.bind(GLFW_KEY_LEFT_SHIFT, Action::Boost);
+    bindings.bind(GLFW_KEY_R, Action::Restart);
+    bindings.bind(GLFW_KEY_P, Action::Pause);
+    bindings.bind(GLFW_KEY_A, Action::Autopilot);
+    bindings.bind(GLFW_KEY_H, Action::Hamiltonian);
+    bindings.bind(GLFW_KEY_M, Action::MonteCarlo);
+    bindings.bind(GLFW_KEY_COMMA, Action::RotateLeft);
+    bindings.bind(GLFW_KEY_PERIOD, Action::RotateRight);
+    bindings.bind(GLFW_KEY_EQUAL, Action::ZoomIn);
+    bindings.bind(GLFW_KEY_KP_ADD, Action::ZoomIn);
+    bindings.bind(GLFW_KEY_MINUS, Action::ZoomOut);
+    bindings.bind(GLFW_KEY_KP_SUBTRACT, Action::ZoomOut);
+
+    return bindings;
+}
+
+void KeyBindings::bind(int key, Action action) {
+    if (key < 0 || static_cast<size_t>(key) >= size) {
+        throw std::runtime_error{"Key code is out of range"};
+    }
+
+    mActions[key] = action;
+}
+
+//endregion
+
+//region Input
+
+Input::Input(KeyBindings bindings)
+    : mBindings{bindings}
+{
+    // more events than that between two ticks would need very fast fingers
+    mEvents.reserve(64);
+}
+
+bool Input::onKey(int key, bool pressed, std::chrono::steady_clock::time_point time) {
+    const auto action {mBindings.action(key)};
+    if (action == Action::None) {
+        return false;
+    }
+
+    mHeld.set(static_cast<size_t>(action), pressed);
+    mEvents.push_back({time, action, pressed});
+
+    return true;
+}
+
+void Input::endTick() {
+    mEvents.clear();
+}
+
+//endregion
+
+}
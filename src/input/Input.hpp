@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace app::input {
+
+enum class Action : std::uint8_t {
+    None,
+    Up, Down, Left, Right,
+    Boost,
+    Restart, Pause,
+    Autopilot, Hamiltonian, MonteCarlo,
+    RotateLeft, RotateRight,
+    ZoomIn, ZoomOut,
+};
+
+constexpr size_t actionCount {static_cast<size_t>(Action::ZoomOut) + 1};
+
+struct KeyEvent {
+    std::chrono::steady_clock::time_point time;
+    Action action;
+    bool pressed;
+};
+
+/// Flat key to action table, indexed directly by GLFW key codes
+class KeyBindings {
+public:
+    static constexpr size_t size {512};
+
+    /// Arrows turn, shift boosts, R/P/A/H/M, comma/period turn the camera and plus/minus zoom
+    static KeyBindings defaults();
+
+    inline Action action(int key) const {
+        return key >= 0 && static_cast<size_t>(key) < size ? mActions[key] : Action::None;
+    }
+    void bind(int key, Action action);
+
+private:
+    std::array<Action, size> mActions {};
+};
+
+/**
+ * Held actions, plus the key events since the last tick with the time they arrived,
+ * so objects see every press in order even when several come between two ticks.
+ */
+class Input {
+public:
+    explicit Input(KeyBindings bindings = KeyBindings::defaults());
+
+    Input(Input &&other) noexcept = default;
+    Input & operator=(Input &&other) noexcept = default;
+    ~Input() noexcept = default;
+
+    /// Returns false when the key is not bound to anything
+    bool onKey(int key, bool pressed, std::chrono::steady_clock::time_point time);
+    /// Forgets the events, after the scene has ticked with them
+    void endTick();
+
+    inline bool isHeld(Action action) const {
+        return mHeld.test(static_cast<size_t>(action));
+    }
+    inline std::span<const KeyEvent> events() const {
+        return mEvents;
+    }
+
+private:
+    KeyBindings mBindings;
+    std::bitset<actionCount> mHeld {};
+    std::vector<KeyEvent> mEvents {};
+};
+
+}
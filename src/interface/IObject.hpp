@@ -1,18 +1,32 @@
 #pragma once
 
 #include <glm/glm.hpp>
-#include <set>
+#include <chrono>
+#include <optional>
 #include "./common.hpp"
 
 class GLFWwindow;
 
 namespace app {
 
+namespace input { class Input; }
+namespace util { class FramePacket; class FrameStats; class JobSystem; }
+
 struct IObject {
     virtual IObject& setCamera(const glm::mat4& view) = 0;
     virtual IObject& setProjection(const glm::mat4& projection) = 0;
-    virtual void render() = 0;
-    virtual void tick(const std::set<int>& pressedKeys) {};
+    /**
+     * CPU side of a frame, with the scene locked: builds the data of the frame in `frame` and records the GL calls
+     * that draw it, but calls no GL itself. The calls run later on the GL thread while the scene goes on, so they
+     * use only what they captured and what no other thread touches. Work that splits goes to `jobs`,
+     * culling counts to `stats`.
+     */
+    virtual void prepare(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) = 0;
+    virtual void tick(const input::Input& /* input */) {};
+    /// When `tick()` has something to do without input changes
+    virtual std::optional<std::chrono::steady_clock::time_point> nextTickTime() const { return std::nullopt; };
+    /// When `prepare()` would draw something new, a past time once changed and nothing while the last frame is current
+    virtual std::optional<std::chrono::steady_clock::time_point> nextFrameTime() const { return std::nullopt; };
 
     INTERFACE_COMMON(IObject)
 };
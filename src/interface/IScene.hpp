@@ -1,20 +1,31 @@
 #pragma once
 
 #include <gsl/pointers>
-#include <set>
+#include <chrono>
+#include <optional>
 #include "./common.hpp"
 
 class GLFWwindow;
 
 namespace app {
 
+namespace input { class Input; }
+namespace util { class FramePacket; class FrameStats; }
+
 struct IObject;
 
 struct IScene {
     virtual IScene& add(gsl::not_null<IObject*> object) = 0;
     virtual IScene& remove(gsl::not_null<IObject*> object) = 0;
-    virtual void render() = 0;
-    virtual void tick(const std::set<int>& pressedKeys) = 0;
+    /// The next frame into `frame`, see `IObject::prepare()`
+    virtual void prepare(util::FramePacket& frame) = 0;
+    virtual void tick(const input::Input& input) = 0;
+    virtual std::optional<std::chrono::steady_clock::time_point> nextTickTime() const = 0;
+    /// Earliest `IObject::nextFrameTime()`, or a past time after `invalidate()`
+    virtual std::optional<std::chrono::steady_clock::time_point> nextFrameTime() const = 0;
+    /// The window lost its contents, the next frame has to be drawn
+    virtual void invalidate() = 0;
+    virtual const util::FrameStats& frameStats() const = 0;
 
     INTERFACE_COMMON(IScene)
 };
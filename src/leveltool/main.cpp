@@ -0,0 +1,127 @@
+#include <engine/Level.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace app;
+
+struct Map {
+    engine::Bitboard walls;
+    glm::uvec2 start;
+};
+
+/// `#` is a wall and `@` the head of the snake, the first line is the top row, short lines are padded with floor
+Map readText(const std::string& path) {
+    std::ifstream file {path};
+    if (!file) {
+        throw std::runtime_error{"Unable to read " + path};
+    }
+
+    std::vector<std::string> lines {};
+    for (std::string line {}; std::getline(file, line);) {
+        lines.push_back(line);
+    }
+
+    size_t size {lines.size()};
+    for (const auto& line : lines) {
+        size = std::max(size, line.size());
+    }
+    if (size < 3) {
+        throw std::runtime_error{"Level is too small"};
+    }
+
+    Map map {engine::Bitboard{static_cast<unsigned int>(size)}, {size / 2, size / 2}};
+    for (size_t row = 0; row < lines.size(); ++row) {
+        const auto y {static_cast<unsigned int>(size - 1 - row)};
+        for (size_t x = 0; x < lines[row].size(); ++x) {
+            if (lines[row][x] == '#') {
+                map.walls.set({x, y});
+            } else if (lines[row][x] == '@') {
+                map.start = {x, y};
+            }
+        }
+    }
+
+    return map;
+}
+
+/// Empty board of any size, optionally walled in and with a pillar every `pillars` cells
+Map generate(unsigned int size, bool border, unsigned int pillars) {
+    Map map {engine::Bitboard{size}, {size / 2, size / 2}};
+
+    for (unsigned int i = 0; border && i < size; ++i) {
+        map.walls.set({i, 0});
+        map.walls.set({i, size - 1});
+        map.walls.set({0, i});
+        map.walls.set({size - 1, i});
+    }
+    for (unsigned int y = pillars; pillars > 0 && y + 1 < size; y += pillars) {
+        for (unsigned int x = pillars; x + 1 < size; x += pillars) {
+            map.walls.set({x, y});
+        }
+    }
+
+    // keep the start free
+    for (unsigned int i = 0; i < 3; ++i) {
+        map.walls.reset({map.start.x, map.start.y - i});
+    }
+
+    return map;
+}
+
+}
+
+/**
+ * Writes a `.level` file from a text map, `snake_leveltool maze.level maze.txt`,
+ * or generates an empty one, `snake_leveltool huge.level --size 16384 --border --pillars 32`.
+ */
+int main(int argc, char* argv[])
+{
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <output.level> (<map.txt> | --size N [--border] [--pillars K])" << std::endl;
+        return 1;
+    }
+
+    try {
+        unsigned int size {0}, pillars {0};
+        bool border {false};
+        std::string textPath {};
+
+        for (int i = 2; i < argc; ++i) {
+            const std::string argument {argv[i]};
+
+            if (argument == "--border") {
+                border = true;
+            } else if (argument == "--size" && i + 1 < argc) {
+                size = std::stoul(argv[++i]);
+            } else if (argument == "--pillars" && i + 1 < argc) {
+                pillars = std::stoul(argv[++i]);
+            } else {
+                textPath = argument;
+            }
+        }
+
+        if (textPath.empty() && size < 8) {
+            throw std::runtime_error{"Generated levels are at least 8 cells across"};
+        }
+
+        const auto map {textPath.empty() ? generate(size, border, pillars) : readText(textPath)};
+        engine::Level::write(argv[1], map.walls, map.start);
+
+        // the game refuses files that don't load
+        const auto level {engine::Level::load(argv[1])};
+        std::cout
+            << level->size() << "x" << level->size() << ", " << map.walls.count() << " walls, "
+            << level->freeCells() << " free cells" << std::endl;
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+#include <server/Client.hpp>
+#include <server/Server.hpp>
+#include <sys/epoll.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::string host {"127.0.0.1"};
+    unsigned short port {app::server::defaultPort};
+    unsigned int clients {2000};
+    unsigned int threads {2};
+    unsigned int seconds {10};
+    bool embedded {false};
+};
+
+struct Results {
+    std::vector<std::int64_t> latencies; // ns between scheduled step and state arrival
+    size_t games {0};
+};
+
+Results runClients(const Options& options, unsigned int count, std::atomic<bool>& stop, unsigned int seed) {
+    using namespace app;
+
+    Results results {};
+    std::minstd_rand random {seed};
+
+    std::vector<server::Client> clients {};
+    clients.reserve(count);
+
+    const server::FileDescriptor epoll {epoll_create1(EPOLL_CLOEXEC)};
+    for (unsigned int i = 0; i < count; ++i) {
+        auto& client {clients.emplace_back(options.host, options.port)};
+
+        epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.u32 = i;
+        epoll_ctl(epoll.get(), EPOLL_CTL_ADD, client.fd(), &event);
+
+        client.join();
+    }
+
+    std::array<epoll_event, 256> events {};
+
+    while (!stop.load(std::memory_order_relaxed)) {
+        const int ready {epoll_wait(epoll.get(), events.data(), events.size(), 100)};
+
+        for (int i = 0; i < ready; ++i) {
+            auto& client {clients[events[i].data.u32]};
+
+            while (client.receive()) {
+                const auto& state {client.state()};
+
+                if (state.step() > 0) {
+                    results.latencies.push_back((std::chrono::steady_clock::now() - client.deadline()).count());
+                }
+
+                if (state.status() != server::SessionStatus::Running) {
+                    ++results.games;
+                    client.join();
+                } else if (random() % 4 == 0) {
+                    client.input(static_cast<engine::Direction>(random() % 4), random() % 8 == 0);
+                }
+            }
+        }
+    }
+
+    for (auto& client : clients) {
+        client.leave();
+    }
+
+    return results;
+}
+
+std::int64_t percentile(const std::vector<std::int64_t>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    return sorted[std::min(sorted.size() - 1, static_cast<size_t>(p / 100 * sorted.size()))];
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    Options options {};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string option {argv[i]};
+
+        if (option == "--embedded") {
+            options.embedded = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            std::cerr << "Missing value for " << option << std::endl;
+            return 1;
+        }
+        const std::string value {argv[++i]};
+
+        if (option == "--host") {
+            options.host = value;
+        } else if (option == "--port") {
+            options.port = std::stoul(value);
+        } else if (option == "--clients") {
+            options.clients = std::stoul(value);
+        } else if (option == "--threads") {
+            options.threads = std::max(1ul, std::stoul(value));
+        } else if (option == "--seconds") {
+            options.seconds = std::stoul(value);
+        } else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+
+    app::server::raiseOpenFilesLimit();
+
+    std::unique_ptr<app::server::Server> server {};
+    if (options.embedded) {
+        server = std::make_unique<app::server::Server>(app::server::Settings{.port = options.port});
+        server->start();
+    }
+
+    std::atomic<bool> stop {false};
+    std::vector<Results> results(options.threads);
+    {
+        std::vector<std::jthread> threads {};
+        for (unsigned int i = 0; i < options.threads; ++i) {
+            const unsigned int count {options.clients / options.threads + (i < options.clients % options.threads)};
+            threads.emplace_back([&, i, count]{ results[i] = runClients(options, count, stop, i); });
+        }
+
+        std::this_thread::sleep_for(std::chrono::seconds{options.seconds});
+        stop = true;
+    }
+
+    std::vector<std::int64_t> latencies {};
+    size_t games {0};
+    for (const auto& result : results) {
+        latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+        games += result.games;
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout
+        << "clients " << options.clients
+        << ", steps " << latencies.size()
+        << " (" << latencies.size() / std::max(1u, options.seconds) << "/s)"
+        << ", finished games " << games << std::endl
+        << "tick latency, us:" << std::fixed << std::setprecision(1);
+    for (const auto& [name, p] : {std::pair{"p50", 50.0}, {"p90", 90.0}, {"p99", 99.0}, {"p99.9", 99.9}, {"max", 100.0}}) {
+        std::cout << " " << name << "=" << percentile(latencies, p) / 1000.0;
+    }
+    std::cout << std::endl;
+
+    return 0;
+}
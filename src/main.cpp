@@ -7,29 +7,149 @@
 #include <object/Treat.hpp>
 #include <object/Snake.hpp>
 #include <object/Board.hpp>
+#include <object/SpectatorWall.hpp>
+#include <engine/Level.hpp>
+#include <engine/StateRing.hpp>
+#include <engine/TimerWheel.hpp>
+#include <input/Input.hpp>
+#include <util/Allocations.hpp>
+#include <util/FrameCapture.hpp>
+#include <util/FramePipeline.hpp>
+#include <util/InputLatency.hpp>
+#include <util/Metrics.hpp>
+#include <util/MetricsExporter.hpp>
+#include <util/Trace.hpp>
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
 #include <thread>
-#include <functional>
+#include <mutex>
+#include <condition_variable>
 #include <boost/thread/synchronized_value.hpp>
 
 struct SharedData {
     gsl::not_null<GLFWwindow*> window;
     app::scene::Main scene {};
-    std::set<int> pressedKeys {};
+    app::input::Input input {};
+    app::util::InputLatency latency {};
 
     explicit SharedData(gsl::not_null<GLFWwindow*> w): window{w} {}
     SharedData(SharedData &&other) noexcept = default;
     SharedData & operator=(SharedData &&other) noexcept = default;
 };
 
-int main()
+// input may bring the next tick closer (shift boost), the tick thread has to wake up and reschedule;
+// a tick may change what is on screen, the rendering thread has to wake up and draw
+struct Wakeup {
+    std::mutex mutex;
+    std::condition_variable_any condition;
+    bool requested {false};
+
+    void notify() {
+        {
+            std::lock_guard lock {mutex};
+            requested = true;
+        }
+        condition.notify_one();
+    }
+};
+
+// waits for the scene lock show up on the timeline and in the metrics
+template<typename Synchronized>
+auto synchronizeTraced(Synchronized& synchronized) {
+    TRACE_ZONE("wait for scene lock");
+    const auto begin {std::chrono::steady_clock::now()};
+    auto lock {synchronized.synchronize()};
+    app::util::metrics::lockWait.observe(std::chrono::steady_clock::now() - begin);
+    return lock;
+}
+
+template<typename Synchronized>
+auto tryToSynchronizeTraced(Synchronized& synchronized) {
+    TRACE_ZONE("try scene lock");
+    auto lock {synchronized.try_to_synchronize()};
+    if (!lock.owns_lock()) {
+        TRACE_INSTANT("scene lock busy");
+    }
+    return lock;
+}
+
+int main(int argc, char* argv[])
 {
-    gsl::not_null window {[] {
+    // --wall <tiles> shows that many bot games instead of playing one
+    // --latency-test <turns> types turns into a hidden window and fails when key to present p99 exceeds --latency-budget <ms>
+    // --allocation-test <turns> types turns the same way and fails on any allocation by a tick or a frame after warm-up
+    // --trace <file> is where builds with SNAKE_TRACING write the timeline on exit
+    // --level <file> plays on the walls of a level written by snake_leveltool
+    // --treats <count> keeps that many treats on the board at once, in a few kinds
+    // --capture <directory> records every frame, --capture-format png (default) or raw
+    // --follow <name> draws the game snake_sim publishes to that shared-memory ring instead of playing one
+    // --metrics-port <port> serves the metrics on localhost, --metrics-file <file> rewrites them there every 10 seconds
+    size_t wallTiles {0};
+    size_t latencyTestTurns {0};
+    size_t allocationTestTurns {0};
+    std::chrono::milliseconds latencyBudget {400};
+    std::string tracePath {"snake-trace.json"};
+    std::shared_ptr<const app::engine::Level> level {};
+    size_t treatCount {1};
+    std::filesystem::path capturePath {};
+    auto captureFormat {app::util::FrameEncoder::Format::Png};
+    std::shared_ptr<const app::engine::StateRing> ring {};
+    std::uint16_t metricsPort {0};
+    std::filesystem::path metricsPath {};
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--wall") == 0) {
+            wallTiles = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--latency-test") == 0) {
+            latencyTestTurns = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--allocation-test") == 0) {
+            allocationTestTurns = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--latency-budget") == 0) {
+            latencyBudget = std::chrono::milliseconds{std::stol(argv[++i])};
+        } else if (std::strcmp(argv[i], "--trace") == 0) {
+            tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--level") == 0) {
+            level = app::engine::Level::load(argv[++i]);
+        } else if (std::strcmp(argv[i], "--treats") == 0) {
+            treatCount = std::stoul(argv[++i]);
+        } else if (std::strcmp(argv[i], "--capture") == 0) {
+            capturePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--capture-format") == 0) {
+            const std::string format {argv[++i]};
+            if (format != "png" && format != "raw") {
+                throw std::runtime_error{"Unknown capture format " + format};
+            }
+            captureFormat = format == "raw" ? app::util::FrameEncoder::Format::Raw : app::util::FrameEncoder::Format::Png;
+        } else if (std::strcmp(argv[i], "--follow") == 0) {
+            ring = app::engine::StateRing::open(argv[++i]);
+        } else if (std::strcmp(argv[i], "--metrics-port") == 0) {
+            metricsPort = static_cast<std::uint16_t>(std::stoul(argv[++i]));
+        } else if (std::strcmp(argv[i], "--metrics-file") == 0) {
+            metricsPath = argv[++i];
+        }
+    }
+
+    TRACE_THREAD("main");
+
+    // outlives the game threads, the last dump has every count
+    std::optional<app::util::MetricsExporter> metricsExporter {};
+    if (metricsPort != 0 || !metricsPath.empty()) {
+        metricsExporter.emplace(metricsPort, metricsPath);
+    }
+
+    const size_t syntheticTurns {std::max(latencyTestTurns, allocationTestTurns)};
+    gsl::not_null window {[syntheticTurns] {
         glfwInit();
         glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
         glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
         glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
         glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+        glfwWindowHint(GLFW_VISIBLE, syntheticTurns > 0 ? GLFW_FALSE : GLFW_TRUE);
 
         const auto videoMode {glfwGetVideoMode(glfwGetPrimaryMonitor())};
         if (videoMode == nullptr) {
@@ -51,108 +171,309 @@ int main()
         }
 
         glEnable(GL_DEPTH_TEST);
-        std::srand(std::time(nullptr));
 
         return window;
     }()};
     const auto _cleanupGLFW = gsl::finally(glfwTerminate);
 
-    auto [ sharedData, _objects /* to keep pointers alive */ ] = [window]{
-        auto board{std::make_unique<app::object::Board>()};
-        auto treat{std::make_unique<app::object::Treat>(board.get())};
-        auto snake{std::make_unique<app::object::Snake>(board.get(), treat.get())};
-
+    auto [ sharedData, _objects /* to keep pointers alive */ ] = [window, wallTiles, &level, treatCount, &ring]{
         auto sharedData{std::make_unique<SharedData>(window)};
-        sharedData->scene
-            .add(board.get()).add(treat.get()).add(snake.get());
+        std::vector<std::unique_ptr<app::IObject>> objects {};
 
-        return std::make_tuple(
-            boost::synchronized_value{std::move(sharedData)},
-            std::array<std::unique_ptr<app::IObject>, 3>{
-                std::move(board), std::move(treat), std::move(snake)
-            }
-        );
+        if (wallTiles > 0) {
+            int width, height;
+            glfwGetWindowSize(window, &width, &height);
+
+            auto wall{std::make_unique<app::object::SpectatorWall>(
+                wallTiles, 13, static_cast<float>(width) / static_cast<float>(height)
+            )};
+            sharedData->scene.add(wall.get());
+            objects.push_back(std::move(wall));
+        } else if (ring) {
+            auto board{std::make_unique<app::object::Board>(static_cast<size_t>(ring->boardSize()))};
+            auto treat{std::make_unique<app::object::Treat>(board.get())};
+            auto snake{std::make_unique<app::object::Snake>(board.get(), treat.get(), ring)};
+
+            sharedData->scene.follow(ring);
+            sharedData->scene
+                .add(board.get()).add(treat.get()).add(snake.get());
+
+            objects.push_back(std::move(board));
+            objects.push_back(std::move(treat));
+            objects.push_back(std::move(snake));
+        } else {
+            auto board{std::make_unique<app::object::Board>(level)};
+            auto treat{std::make_unique<app::object::Treat>(board.get())};
+            auto snake{std::make_unique<app::object::Snake>(board.get(), treat.get(), &sharedData->latency)};
+            snake->setTreatCount(treatCount);
+
+            sharedData->scene
+                .add(board.get()).add(treat.get()).add(snake.get());
+
+            objects.push_back(std::move(board));
+            objects.push_back(std::move(treat));
+            objects.push_back(std::move(snake));
+        }
+
+        return std::make_tuple(boost::synchronized_value{std::move(sharedData)}, std::move(objects));
     }();
 
     using SharedDataT = decltype(sharedData);
-    glfwSetWindowUserPointer(window, &sharedData);
-    glfwSetKeyCallback(window, [](GLFWwindow* window, int key, int, int action, int) {
-        std::function<void(std::set<int>& pressedKeys, int key)> keyAction {};
-
-        switch (action) {
-            case GLFW_PRESS:
-                if (GLFW_KEY_ESCAPE == key) {
-                    return glfwSetWindowShouldClose(window, true);
-                }
-                keyAction = [](std::set<int>& pressedKeys, int key){ pressedKeys.insert(key); };
-                break;
-            case GLFW_RELEASE:
-                keyAction = [](std::set<int>& pressedKeys, int key){ pressedKeys.erase(key); };
-                break;
-            default:
-                return;
+    Wakeup tickWakeup {};
+    Wakeup frameWakeup {};
+    using WindowContext = std::tuple<SharedDataT*, Wakeup*, Wakeup*>;
+    WindowContext windowContext {&sharedData, &tickWakeup, &frameWakeup};
+    glfwSetWindowUserPointer(window, &windowContext);
+    constexpr auto onKey {[](GLFWwindow* window, int key, int, int action, int) {
+        // stamped before waiting for the lock, the event happened now
+        const auto time {std::chrono::steady_clock::now()};
+
+        if (action == GLFW_PRESS && GLFW_KEY_ESCAPE == key) {
+            return glfwSetWindowShouldClose(window, true);
+        }
+        if (action != GLFW_PRESS && action != GLFW_RELEASE) {
+            return;
         }
 
-        gsl::not_null sharedData {reinterpret_cast<SharedDataT*>(glfwGetWindowUserPointer(window))};
+        const auto [sharedData, tickWakeup, frameWakeup] {*reinterpret_cast<WindowContext*>(glfwGetWindowUserPointer(window))};
         {
-            auto d {sharedData->synchronize()};
+            const app::util::allocations::SteadyState steadyState {};
+            auto d {synchronizeTraced(*sharedData)};
 
-            keyAction((*d)->pressedKeys, key);
-            (*d)->scene.tick((*d)->pressedKeys);
+            if (!(*d)->input.onKey(key, action == GLFW_PRESS, time)) {
+                return;
+            }
+            (*d)->scene.tick((*d)->input);
+            (*d)->input.endTick();
         }
+        tickWakeup->notify();
+        frameWakeup->notify();
+    }};
+    glfwSetKeyCallback(window, onKey);
+    glfwSetWindowRefreshCallback(window, [](GLFWwindow* window) {
+        const auto [sharedData, tickWakeup, frameWakeup] {*reinterpret_cast<WindowContext*>(glfwGetWindowUserPointer(window))};
+
+        (*sharedData->synchronize())->scene.invalidate();
+        frameWakeup->notify();
     });
 
     glfwMakeContextCurrent(nullptr);
-    std::jthread renderingThread {[&sharedData](std::stop_token stop_token){
-        glfwMakeContextCurrent((*sharedData.synchronize())->window);
+    // the frame thread prepares frames with the scene locked, the rendering thread submits and presents them without it,
+    // so the next frame is prepared while the GL thread is busy with the last one
+    app::util::FramePipeline pipeline {};
 
-        constexpr std::chrono::milliseconds frameInterval {std::milli::den/30};
+    std::jthread renderingThread {[&sharedData, &pipeline, &frameWakeup, &capturePath, captureFormat](std::stop_token stop_token){
+        using Clock = std::chrono::steady_clock;
+        TRACE_THREAD("render");
+        const gsl::not_null window {(*sharedData.synchronize())->window};
+        glfwMakeContextCurrent(window);
 
-        while (!stop_token.stop_requested()) {
-            auto beginTime {std::chrono::system_clock::now()};
+        // read back asynchronously, the frame rate stays the same
+        std::optional<app::util::FrameCapture> capture {};
+        if (!capturePath.empty()) {
+            capture.emplace(capturePath, captureFormat);
+        }
 
-            if (auto d {sharedData.try_to_synchronize(/* least important */)}; d.owns_lock()) {
-                (*d)->scene.render();
-                glfwSwapBuffers((*d)->window);
+        while (const auto packet {pipeline.beginSubmit(stop_token)}) {
+            const app::util::allocations::SteadyState steadyState {};
+            const auto submitTime {Clock::now()};
+            {
+                TRACE_ZONE("submit frame");
+                packet->submit();
+            }
+            if (capture.has_value()) {
+                capture->capture();
+            }
+            {
+                TRACE_ZONE("glfwSwapBuffers");
+                glfwSwapBuffers(window);
             }
+            const auto presentTime {Clock::now()};
+            app::util::metrics::frameTime.observe(presentTime - submitTime);
+            app::util::metrics::framesRendered.add();
 
-            if (
-                auto sleepDuration {std::chrono::duration_cast<std::chrono::milliseconds>(
-                    frameInterval - (std::chrono::system_clock::now() - beginTime)
-                )};
-                sleepDuration.count() > 0
-            ) {
-                std::this_thread::sleep_for(sleepDuration);
+            if (packet->presentsTurn) {
+                (*synchronizeTraced(sharedData))->latency.presented(presentTime);
             }
+
+            pipeline.endSubmit();
+            frameWakeup.notify();
+        }
+
+        if (capture.has_value()) {
+            capture->finish();
+            capture->report(std::cout);
         }
     }};
 
-    std::jthread tickThread {[&sharedData](std::stop_token stop_token){
-        constexpr std::chrono::milliseconds tickInterval {std::milli::den/100};
+    std::jthread frameThread {[&sharedData, &pipeline, &frameWakeup](std::stop_token stop_token){
+        using Clock = std::chrono::steady_clock;
+        TRACE_THREAD("frame");
 
+        constexpr std::chrono::milliseconds frameInterval {std::milli::den/30};
+        constexpr std::chrono::hours idleInterval {1};
+        Clock::time_point lastFrameTime {};
+
+        // frames only when something on screen changes, at most 30 per second
         while (!stop_token.stop_requested()) {
-            auto beginTime {std::chrono::system_clock::now()};
+            const app::util::allocations::SteadyState steadyState {};
+            const auto beginTime {Clock::now()};
+            std::optional<Clock::time_point> nextFrameTime {beginTime + frameInterval}; // busy, try again later
 
-            {
-                auto d {sharedData.synchronize()};
+            if (auto d {tryToSynchronizeTraced(sharedData /* least important */)}; d.owns_lock()) {
+                nextFrameTime = (*d)->scene.nextFrameTime();
+
+                if (nextFrameTime.has_value() && *nextFrameTime <= beginTime && beginTime >= lastFrameTime + frameInterval) {
+                    // both packets still with the rendering thread, it wakes this one up when it is done with the oldest
+                    if (const auto packet {pipeline.beginPrepare()}) {
+                        (*d)->scene.prepare(*packet);
+                        packet->presentsTurn = (*d)->latency.rendered(Clock::now());
+                        pipeline.endPrepare();
+
+                        lastFrameTime = beginTime;
+                        nextFrameTime = (*d)->scene.nextFrameTime();
+                    } else {
+                        nextFrameTime = beginTime + idleInterval;
+                    }
+                }
+            } else {
+                // the tick or input thread held the scene, this frame comes later if at all
+                app::util::metrics::framesDropped.add();
+            }
+
+            std::unique_lock lock {frameWakeup.mutex};
+            frameWakeup.condition.wait_until(
+                lock, stop_token,
+                std::max(lastFrameTime + frameInterval, nextFrameTime.value_or(beginTime + idleInterval)),
+                [&frameWakeup] { return frameWakeup.requested; }
+            );
+            frameWakeup.requested = false;
+        }
+    }};
+
+    std::jthread tickThread {[&sharedData, &tickWakeup, &frameWakeup](std::stop_token stop_token){
+        using Clock = app::engine::TimerWheel::Clock;
+        constexpr std::chrono::hours idleInterval {1};
+        TRACE_THREAD("tick");
 
-                (*d)->scene.tick((*d)->pressedKeys);
+        app::engine::TimerWheel timers {};
+        const auto sceneTimer {timers.add(Clock::now())};
+
+        const auto tickScene {[&](bool tick) {
+            const app::util::allocations::SteadyState steadyState {};
+            auto d {synchronizeTraced(sharedData)};
+
+            if (tick) {
+                (*d)->scene.tick((*d)->input);
+                frameWakeup.notify();
             }
+            timers.reschedule(sceneTimer, (*d)->scene.nextTickTime().value_or(Clock::now() + idleInterval));
+        }};
 
-            if (
-                auto sleepDuration {std::chrono::duration_cast<std::chrono::milliseconds>(
-                    tickInterval - (std::chrono::system_clock::now() - beginTime)
-                )};
-                sleepDuration.count() > 0
-            ) {
-                std::this_thread::sleep_for(sleepDuration);
+        while (!stop_token.stop_requested()) {
+            timers.expire(Clock::now(), [&](auto, auto) { tickScene(true); });
+
+            std::unique_lock lock {tickWakeup.mutex};
+            if (tickWakeup.condition.wait_until(
+                lock, stop_token, timers.nextDeadline().value_or(Clock::now() + idleInterval),
+                [&tickWakeup] { return tickWakeup.requested; }
+            )) {
+                tickWakeup.requested = false;
+                lock.unlock();
+
+                tickScene(false);
             }
         }
     }};
 
-    while (!glfwWindowShouldClose(window)) {
-        glfwWaitEvents();
+    // a followed game ticks when the other process publishes, and sleeps while it does not
+    std::jthread followThread {};
+    if (ring) {
+        followThread = std::jthread{[&sharedData, &frameWakeup, ring](std::stop_token stop_token) {
+            constexpr std::chrono::milliseconds stopCheckInterval {100};
+            TRACE_THREAD("follow");
+
+            std::uint64_t seen {0};
+            while (!stop_token.stop_requested()) {
+                if (!ring->waitPublished(seen, stopCheckInterval)) {
+                    continue;
+                }
+                seen = ring->published();
+
+                {
+                    const app::util::allocations::SteadyState steadyState {};
+                    auto d {synchronizeTraced(sharedData)};
+                    (*d)->scene.tick((*d)->input);
+                }
+                frameWakeup.notify();
+            }
+        }};
+    }
+
+    // the first round of turns, a new game included, warms up every buffer that grows
+    constexpr size_t warmUpTurns {16};
+    size_t warmUpAllocations {0};
+
+    if (syntheticTurns == 0) {
+        while (!glfwWindowShouldClose(window)) {
+            glfwWaitEvents();
+        }
+    } else {
+        // synthetic presses through the real key callback, off the move and frame grid; R now and then keeps the game alive
+        constexpr std::array turnKeys {GLFW_KEY_LEFT, GLFW_KEY_UP, GLFW_KEY_RIGHT, GLFW_KEY_UP};
+        constexpr std::chrono::milliseconds pressInterval {450};
+
+        for (size_t turn = 0; turn < syntheticTurns && !glfwWindowShouldClose(window); ++turn) {
+            if (turn == warmUpTurns) {
+                warmUpAllocations = app::util::allocations::steadyState();
+            }
+            if (turn % 16 == 0) {
+                onKey(window, GLFW_KEY_R, 0, GLFW_PRESS, 0);
+                onKey(window, GLFW_KEY_R, 0, GLFW_RELEASE, 0);
+            }
+
+            std::this_thread::sleep_for(pressInterval);
+            onKey(window, turnKeys[turn % turnKeys.size()], 0, GLFW_PRESS, 0);
+            onKey(window, turnKeys[turn % turnKeys.size()], 0, GLFW_RELEASE, 0);
+            glfwPollEvents();
+        }
+        std::this_thread::sleep_for(pressInterval);
+    }
+
+    if constexpr (app::util::trace::enabled) {
+        app::util::trace::write(tracePath);
+    }
+
+    auto d {sharedData.synchronize()};
+    const auto& latency {(*d)->latency};
+    if (!latency.samples().empty()) {
+        latency.report(std::cout);
+    }
+    if ((*d)->scene.frameStats().frames() > 0) {
+        (*d)->scene.frameStats().report(std::cout);
+    }
+
+    bool passed {true};
+    if (latencyTestTurns > 0) {
+        const auto p99 {latency.distribution(&app::util::InputLatency::Sample::present).p99};
+        const bool latencyPassed {latency.samples().size() * 2 >= latencyTestTurns && p99 <= latencyBudget};
+
+        std::cout << "latency test " << (latencyPassed ? "passed" : "failed") << ": " << latency.samples().size() << " of "
+            << latencyTestTurns << " turns presented, budget " << latencyBudget.count() << " ms" << std::endl;
+        passed &= latencyPassed;
+    }
+    if (allocationTestTurns > warmUpTurns) {
+        const auto allocations {app::util::allocations::steadyState() - warmUpAllocations};
+        const bool allocationPassed {allocations == 0};
+
+        std::cout << "allocation test " << (allocationPassed ? "passed" : "failed") << ": " << allocations
+            << " allocations by ticks and frames after " << warmUpTurns << " warm-up turns, "
+            << app::util::allocations::total() << " in total" << std::endl;
+        passed &= allocationPassed;
+    } else if (allocationTestTurns > 0) {
+        std::cout << "allocation test needs more than " << warmUpTurns << " turns" << std::endl;
+        passed = false;
     }
 
-    return 0;
+    return passed ? 0 : 1;
 }
@@ -0,0 +1,155 @@
+#include <util/Mesh.hpp>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using app::util::Mesh;
+
+struct LodSource {
+    float minCellPixels;
+    std::string path;
+};
+
+/// 1-based, negative counts back from the last vertex read so far
+std::uint32_t objIndex(const std::string& token, size_t vertexCount) {
+    const long index {std::stol(token.substr(0, token.find('/')))};
+    const long resolved {index < 0 ? static_cast<long>(vertexCount) + index : index - 1};
+
+    if (resolved < 0 || static_cast<size_t>(resolved) >= vertexCount) {
+        throw std::runtime_error{"Face index " + token + " out of range"};
+    }
+
+    return static_cast<std::uint32_t>(resolved);
+}
+
+/**
+ * Appends the vertices and the triangles of a Wavefront OBJ file, only `v` and `f` lines matter.
+ * Vertex colors come from `v x y z r g b` lines or `color`, faces are split into fans.
+ */
+void readObj(const std::string& path, const glm::vec3& color, std::vector<float>& vertices, std::vector<std::uint32_t>& indices) {
+    std::ifstream file {path};
+    if (!file) {
+        throw std::runtime_error{"Unable to read " + path};
+    }
+
+    const size_t firstVertex {vertices.size() / Mesh::vertexFloats};
+
+    for (std::string line {}; std::getline(file, line);) {
+        std::istringstream stream {line};
+        std::string type {};
+        stream >> type;
+
+        if (type == "v") {
+            float values[6] {0, 0, 0, color.r, color.g, color.b};
+            for (size_t i = 0; i < 6 && stream >> values[i]; ++i) {}
+            vertices.insert(vertices.end(), std::begin(values), std::end(values));
+        } else if (type == "f") {
+            const size_t vertexCount {vertices.size() / Mesh::vertexFloats - firstVertex};
+
+            std::vector<std::uint32_t> face {};
+            for (std::string token {}; stream >> token;) {
+                face.push_back(objIndex(token, vertexCount));
+            }
+            if (face.size() < 3) {
+                throw std::runtime_error{"Face with less than 3 vertices in " + path};
+            }
+
+            for (size_t i = 1; i + 1 < face.size(); ++i) {
+                indices.insert(indices.end(), {face[0], face[i], face[i + 1]});
+            }
+        }
+    }
+}
+
+glm::vec3 parseColor(const std::string& value) {
+    glm::vec3 color {};
+    char comma {};
+    std::istringstream stream {value};
+    if (!(stream >> color.r >> comma >> color.g >> comma >> color.b)) {
+        throw std::runtime_error{"Color is r,g,b from 0 to 1"};
+    }
+    return color;
+}
+
+}
+
+/**
+ * Converts OBJ models into a `.mesh` file with one LOD per model:
+ * `snake_meshtool segment.mesh [--color r,g,b] 8=segment-high.obj 3=segment-low.obj 0=segment-top.obj`.
+ * Models are in cells: a cell is 1 across, centered on the origin, with the board at z = 0.
+ */
+int main(int argc, char* argv[])
+{
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <output.mesh> [--color r,g,b] <min-cell-pixels>=<lod.obj>..." << std::endl;
+        return 1;
+    }
+
+    try {
+        glm::vec3 color {0.8f, 0.8f, 0.8f};
+        std::vector<LodSource> sources {};
+
+        for (int i = 2; i < argc; ++i) {
+            const std::string argument {argv[i]};
+
+            if (argument == "--color" && i + 1 < argc) {
+                color = parseColor(argv[++i]);
+                continue;
+            }
+
+            const auto separator {argument.find('=')};
+            if (separator == std::string::npos) {
+                throw std::runtime_error{"Expected <min-cell-pixels>=<lod.obj>, got " + argument};
+            }
+            sources.push_back({std::stof(argument.substr(0, separator)), argument.substr(separator + 1)});
+        }
+
+        if (sources.empty()) {
+            throw std::runtime_error{"No LOD models"};
+        }
+
+        // finest first, the coarsest one covers any cell size
+        std::stable_sort(sources.begin(), sources.end(), [](const auto& a, const auto& b) {
+            return a.minCellPixels > b.minCellPixels;
+        });
+        sources.back().minCellPixels = 0;
+
+        std::vector<Mesh::Lod> lods {};
+        std::vector<float> vertices {};
+        std::vector<std::uint32_t> indices {};
+
+        for (const auto& source : sources) {
+            Mesh::Lod lod {
+                source.minCellPixels,
+                static_cast<std::uint32_t>(vertices.size() / Mesh::vertexFloats), 0,
+                static_cast<std::uint32_t>(indices.size()), 0,
+            };
+
+            readObj(source.path, color, vertices, indices);
+
+            lod.vertexCount = static_cast<std::uint32_t>(vertices.size() / Mesh::vertexFloats) - lod.firstVertex;
+            lod.indexCount = static_cast<std::uint32_t>(indices.size()) - lod.firstIndex;
+            lods.push_back(lod);
+
+            std::cout
+                << source.path << ": " << lod.vertexCount << " vertices, " << lod.indexCount / 3
+                << " triangles from " << lod.minCellPixels << " px cells" << std::endl;
+        }
+
+        Mesh::write(argv[1], lods, vertices, indices);
+
+        // the game refuses files that don't load
+        Mesh::load(argv[1]);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
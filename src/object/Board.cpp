@@ -1,4 +1,10 @@
 #include "Board.hpp"
+#include <object/Geometry.hpp>
+#include <util/FramePacket.hpp>
+#include <util/FrameStats.hpp>
+#include <util/JobSystem.hpp>
+#include <util/Metrics.hpp>
+#include <util/Trace.hpp>
 #include <glad/glad.h>
 #include <stdexcept>
 #include <gsl/util>
@@ -6,13 +12,28 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <algorithm>
+#include <array>
 
 namespace app::object {
 
 //region Constructor & Destructor
 
-Board::Board()
-    : mSize{13}
+Board::Board(std::shared_ptr<const engine::Level> level)
+    : mLevel{std::move(level)}
+    , mSize{mLevel ? mLevel->size() : 13}
+    , mCellSize{10}
+    , mShaderProgram{createShaderProgram()}
+{
+    createVao();
+
+    if (mLevel) {
+        mChunksPerSide = mLevel->wordsPerRow();
+        mChunks.resize(static_cast<size_t>(mChunksPerSide) * mChunksPerSide);
+    }
+}
+
+Board::Board(size_t size)
+    : mSize{size}
     , mCellSize{10}
     , mShaderProgram{createShaderProgram()}
 {
@@ -22,30 +43,124 @@ Board::Board()
 Board::~Board() noexcept {
     glBindVertexArray(0);
     glDeleteVertexArrays(1, &mVao);
-    glDeleteFramebuffers(1, &mVbo);
-    glDeleteFramebuffers(1, &mEbo);
+    glDeleteBuffers(1, &mVbo);
+    glDeleteBuffers(1, &mEbo);
+
+    for (const auto& chunk : mChunks) {
+        if (chunk.vao != 0) {
+            glDeleteVertexArrays(1, &chunk.vao);
+            glDeleteBuffers(1, &chunk.vbo);
+            glDeleteBuffers(1, &chunk.ebo);
+        }
+    }
 }
 
 //endregion
 
 //region Public Methods
 
-void Board::render() {
-    glUseProgram(mShaderProgram.id());
+void Board::prepare(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) {
+    TRACE_ZONE("Board::prepare");
 
-    if (mPendingCameraUpdate.has_value()) {
-        mShaderProgram.setUniform("view", mPendingCameraUpdate.value());
+    const bool cameraChanged {mPendingCameraUpdate.has_value() || mPendingProjectionUpdate.has_value()};
+    if (cameraChanged) {
+        mView = mPendingCameraUpdate.value_or(mView);
+        mProjection = mPendingProjectionUpdate.value_or(mProjection);
         mPendingCameraUpdate.reset();
-    }
-    if (mPendingProjectionUpdate.has_value()) {
-        mShaderProgram.setUniform("projection", mPendingProjectionUpdate.value());
         mPendingProjectionUpdate.reset();
+        mFrustum = util::Frustum{mProjection * mView};
     }
 
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, std::pow(size(), 2) * 6, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
-    glUseProgram(0);
+    // walls sit a little above the floor
+    const float wallHeight {0.5f / mSize};
+
+    // only chunks in view, a few more loaded each frame so the first one is not held up by a big level
+    auto& culling {stats.frame().boardChunks};
+    const auto visible {frame.allocate<unsigned int>(mChunks.size())};
+    size_t visibleCount {0};
+    std::array<unsigned int, chunkUploadsPerFrame> loads {};
+    std::array<size_t, chunkUploadsPerFrame> loadRuns {};
+    size_t loadCount {0};
+    size_t loadBytes {0};
+    mPendingChunks = false;
+    for (size_t index = 0; index < mChunks.size(); ++index) {
+        auto& chunk {mChunks[index]};
+        const auto [min, max] {wallChunkBounds(*mLevel, chunkPosition(index), wallHeight)};
+        if (!mFrustum.intersects(min, max)) {
+            ++culling.culled;
+            continue;
+        }
+        ++culling.visible;
+
+        if (!chunk.loaded) {
+            // a run of walls is 8 floats and 6 indices in the frame arena
+            const auto runs {wallChunkRuns(*mLevel, chunkPosition(index))};
+            const auto bytes {runs * (8 * sizeof(float) + 6 * sizeof(unsigned int))};
+            if (loadCount == chunkUploadsPerFrame || (loadCount > 0 && loadBytes + bytes > chunkBytesPerFrame)) {
+                mPendingChunks = true;
+                continue;
+            }
+            chunk.loaded = true;
+            loads[loadCount] = gsl::narrow_cast<unsigned int>(index);
+            loadRuns[loadCount++] = runs;
+            loadBytes += bytes;
+        }
+        visible[visibleCount++] = gsl::narrow_cast<unsigned int>(index);
+    }
+
+    // the walls of new chunks are built in frame storage on the workers, the GL thread only uploads them,
+    // before the draws that need them
+    if (loadCount > 0) {
+        std::array<std::pair<std::span<float>, std::span<unsigned int>>, chunkUploadsPerFrame> geometry {};
+        for (size_t load = 0; load < loadCount; ++load) {
+            geometry[load] = {frame.allocate<float>(loadRuns[load] * 8), frame.allocate<unsigned int>(loadRuns[load] * 6)};
+        }
+
+        jobs.parallelFor(loadCount, 1, [&](size_t begin, size_t end) {
+            for (size_t load = begin; load < end; ++load) {
+                wallChunkVeboData(*mLevel, chunkPosition(loads[load]), geometry[load].first, geometry[load].second);
+            }
+        });
+
+        for (size_t load = 0; load < loadCount; ++load) {
+            frame.record([this, chunk{loads[load]}, vertices{geometry[load].first}, indices{geometry[load].second}] {
+                loadChunk(mChunks[chunk], vertices, indices);
+            });
+        }
+    }
+
+    frame.record([this, cameraChanged, view{mView}, projection{mProjection}, wallHeight, visible{visible.first(visibleCount)}] {
+        glUseProgram(mShaderProgram.id());
+        if (cameraChanged) {
+            mShaderProgram.setUniform("view", view);
+            mShaderProgram.setUniform("projection", projection);
+        }
+
+        mShaderProgram.setUniform("height", 0.0f);
+        mShaderProgram.setUniform("shade", 1.0f);
+        glBindVertexArray(mVao);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+
+        mShaderProgram.setUniform("height", wallHeight);
+        mShaderProgram.setUniform("shade", 0.45f);
+        for (const auto index : visible) {
+            if (const auto& chunk {mChunks[index]}; chunk.indexCount > 0) {
+                glBindVertexArray(chunk.vao);
+                glDrawElements(GL_TRIANGLES, chunk.indexCount, GL_UNSIGNED_INT, 0);
+            }
+        }
+
+        glBindVertexArray(0);
+        glUseProgram(0);
+    });
+}
+
+std::optional<std::chrono::steady_clock::time_point> Board::nextFrameTime() const {
+    if (mPendingCameraUpdate.has_value() || mPendingProjectionUpdate.has_value() || mPendingChunks) {
+        return std::chrono::steady_clock::time_point::min();
+    }
+
+    return std::nullopt;
 }
 
 IObject& Board::setCamera(const glm::mat4 &view) {
@@ -72,17 +187,19 @@ layout (location = 0) in vec2 pos;
 
 uniform mat4 view;
 uniform mat4 projection;
+uniform float height;
 
 void main() {
-   gl_Position = projection * view * vec4(pos, 0.0, 1.0);
+   gl_Position = projection * view * vec4(pos, height, 1.0);
 }
 )";
 
     const char* fragmentShaderSource = R"(
 #version 330 core
+uniform float shade;
 out vec4 FragColor;
 void main() {
-    FragColor = vec4(0.280, 0.276, 0.276, 1.0f);
+    FragColor = vec4(vec3(0.280, 0.276, 0.276) * shade, 1.0f);
 }
 )";
 
@@ -90,7 +207,8 @@ void main() {
 }
 
 void Board::createVao() {
-    const auto [ vertices, indices ] = generateVeboData();
+    // the cells tile the whole board, one quad looks the same
+    const auto [ vertices, indices ] = boardVeboData(1);
 
     unsigned int vbo, ebo, vao;
     glGenVertexArrays(1, &vao);
@@ -103,7 +221,7 @@ void Board::createVao() {
     glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * vertices.size(), indices.data(), GL_STATIC_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(), indices.data(), GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
@@ -117,52 +235,32 @@ void Board::createVao() {
     mEbo = ebo;
 }
 
-std::pair<std::vector<float>, std::vector<unsigned int>> Board::generateVeboData() const {
-    constexpr unsigned int verticesPerCell {4};
-    constexpr unsigned int vertexSize {2};
-    constexpr unsigned int indicesPerCell {2};
-    constexpr unsigned int indexSize {3};
-
-    const size_t size {this->size()};
-
-    std::vector<float> vertices {};
-    vertices.reserve(size * size * verticesPerCell * vertexSize);
-
-    std::vector<unsigned int> indices {};
-    indices.reserve(size * size * indicesPerCell * indexSize);
-
-    const float shift {size / 2.0f};
-
-    for (unsigned int x = 0; x != size; ++x) {
-        for (unsigned int y = 0; y != size; ++y) {
-            vertices.push_back(x - shift);
-            vertices.push_back(shift - y);
-
-            vertices.push_back(x - shift + 1);
-            vertices.push_back(shift - y);
+void Board::loadChunk(Chunk& chunk, std::span<const float> vertices, std::span<const unsigned int> indices) {
+    if (indices.empty()) {
+        return;
+    }
 
-            vertices.push_back(x - shift);
-            vertices.push_back(shift - y - 1);
+    glGenVertexArrays(1, &chunk.vao);
+    glGenBuffers(1, &chunk.vbo);
+    glGenBuffers(1, &chunk.ebo);
 
-            vertices.push_back(x - shift + 1);
-            vertices.push_back(shift - y - 1);
+    glBindVertexArray(chunk.vao);
 
-            const unsigned int verticesOffset {gsl::narrow_cast<unsigned int>(vertices.size() / vertexSize)};
+    glBindBuffer(GL_ARRAY_BUFFER, chunk.vbo);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
 
-            indices.push_back(verticesOffset - verticesPerCell);
-            indices.push_back(verticesOffset - verticesPerCell + 1);
-            indices.push_back(verticesOffset - verticesPerCell + 2);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, chunk.ebo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(), indices.data(), GL_STATIC_DRAW);
 
-            indices.push_back(verticesOffset - verticesPerCell + 1);
-            indices.push_back(verticesOffset - verticesPerCell + 2);
-            indices.push_back(verticesOffset - verticesPerCell + 3);
-        }
-    }
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
 
-    // normalize
-    std::for_each(vertices.begin(), vertices.end(), [size](float& value){ value /= size; });
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
-    return {vertices, indices};
+    chunk.indexCount = gsl::narrow_cast<unsigned int>(indices.size());
+    util::metrics::uploadBytes.add(sizeof(float) * vertices.size() + sizeof(unsigned int) * indices.size());
 }
 
 //endregion
@@ -1,16 +1,28 @@
 #pragma once
 
 #include <interface/IObject.hpp>
+#include <engine/Level.hpp>
+#include <memory>
+#include <span>
 #include <utility>
 #include <vector>
 #include <optional>
+#include <util/Frustum.hpp>
 #include <util/ShaderProgram.hpp>
 
 namespace app::object {
 
+/**
+ * The floor, and the walls of a level in chunks of 64x64 cells. Chunks are culled against the view frustum,
+ * visible ones are built from the mapped level on the job workers and uploaded a few per frame, so even huge levels
+ * open at once and chunks never looked at or without walls take no memory.
+ */
 class Board : public IObject {
 public:
-    Board();
+    /// 13x13 without walls when there is no level
+    explicit Board(std::shared_ptr<const engine::Level> level = nullptr);
+    /// Without walls
+    explicit Board(size_t size);
 
     Board(Board &&other) noexcept = default;
     Board & operator=(Board &&other) noexcept = default;
@@ -18,7 +30,8 @@ public:
 
     IObject& setCamera(const glm::mat4 &view) override;
     IObject& setProjection(const glm::mat4 &projection) override;
-    void render() override;
+    void prepare(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) override;
+    std::optional<std::chrono::steady_clock::time_point> nextFrameTime() const override;
 
     inline size_t size() const {
         return mSize;
@@ -26,19 +39,46 @@ public:
     inline size_t cellSize() const {
         return mCellSize;
     }
+    inline const std::shared_ptr<const engine::Level>& level() const {
+        return mLevel;
+    }
 
 private:
+    // `loaded` belongs to the thread preparing frames, the rest to the GL thread
+    struct Chunk {
+        unsigned int vao {0};
+        unsigned int vbo {0};
+        unsigned int ebo {0};
+        unsigned int indexCount {0};
+        bool loaded {false};
+    };
+
     util::ShaderProgram createShaderProgram();
-    std::pair<std::vector<float>, std::vector<unsigned int>> generateVeboData() const;
     void createVao();
+    void loadChunk(Chunk& chunk, std::span<const float> vertices, std::span<const unsigned int> indices);
+    inline glm::uvec2 chunkPosition(size_t index) const {
+        return {index % mChunksPerSide, index / mChunksPerSide};
+    }
+
+    static constexpr size_t chunkUploadsPerFrame {64};
+    // wall geometry built per frame, at least one chunk, so lazy loads fit the frame arenas warm-up grew
+    static constexpr size_t chunkBytesPerFrame {128 * 1024};
 
 private:
+    std::shared_ptr<const engine::Level> mLevel;
     size_t mSize;
     size_t mCellSize;
     util::ShaderProgram mShaderProgram;
     unsigned int mVao;
     unsigned int mVbo;
     unsigned int mEbo;
+
+    unsigned int mChunksPerSide {0};
+    std::vector<Chunk> mChunks;
+    bool mPendingChunks {true}; // visible chunks left for the next frames
+    glm::mat4 mView {1.0f};
+    glm::mat4 mProjection {1.0f};
+    util::Frustum mFrustum;
     std::optional<glm::mat4> mPendingCameraUpdate;
     std::optional<glm::mat4> mPendingProjectionUpdate;
 };
@@ -0,0 +1,305 @@
+#include "Geometry.hpp"
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gsl/util>
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace app::object {
+
+using engine::Direction;
+
+std::pair<std::vector<float>, std::vector<unsigned int>> boardVeboData(size_t size) {
+    constexpr unsigned int verticesPerCell {4};
+    constexpr unsigned int vertexSize {2};
+    constexpr unsigned int indicesPerCell {2};
+    constexpr unsigned int indexSize {3};
+
+    std::vector<float> vertices {};
+    vertices.reserve(size * size * verticesPerCell * vertexSize);
+
+    std::vector<unsigned int> indices {};
+    indices.reserve(size * size * indicesPerCell * indexSize);
+
+    const float shift {size / 2.0f};
+
+    for (unsigned int x = 0; x != size; ++x) {
+        for (unsigned int y = 0; y != size; ++y) {
+            vertices.push_back(x - shift);
+            vertices.push_back(shift - y);
+
+            vertices.push_back(x - shift + 1);
+            vertices.push_back(shift - y);
+
+            vertices.push_back(x - shift);
+            vertices.push_back(shift - y - 1);
+
+            vertices.push_back(x - shift + 1);
+            vertices.push_back(shift - y - 1);
+
+            const unsigned int verticesOffset {gsl::narrow_cast<unsigned int>(vertices.size() / vertexSize)};
+
+            indices.push_back(verticesOffset - verticesPerCell);
+            indices.push_back(verticesOffset - verticesPerCell + 1);
+            indices.push_back(verticesOffset - verticesPerCell + 2);
+
+            indices.push_back(verticesOffset - verticesPerCell + 1);
+            indices.push_back(verticesOffset - verticesPerCell + 2);
+            indices.push_back(verticesOffset - verticesPerCell + 3);
+        }
+    }
+
+    // normalize
+    std::for_each(vertices.begin(), vertices.end(), [size](float& value){ value /= size; });
+
+    return {std::move(vertices), std::move(indices)};
+}
+
+size_t wallChunkRuns(const engine::Level& level, const glm::uvec2& chunk) {
+    const auto words {level.words()};
+    const unsigned int lastRow {std::min(level.size(), (chunk.y + 1) * 64)};
+
+    // a run starts at every wall without a wall left of it
+    size_t runs {0};
+    for (unsigned int y = chunk.y * 64; y < lastRow; ++y) {
+        const auto bits {words[static_cast<size_t>(y) * level.wordsPerRow() + chunk.x]};
+        runs += std::popcount(bits & ~(bits << 1));
+    }
+
+    return runs;
+}
+
+void wallChunkVeboData(
+    const engine::Level& level, const glm::uvec2& chunk, std::span<float> vertices, std::span<unsigned int> indices
+) {
+    const auto size {level.size()};
+    const auto normalize {
+        [size, shift{size / 2}](float coord) -> float {
+            return (coord - shift - 0.5f) / size;
+        }
+    };
+
+    const auto words {level.words()};
+    const unsigned int lastRow {std::min(size, (chunk.y + 1) * 64)};
+    unsigned int run {0};
+
+    for (unsigned int y = chunk.y * 64; y < lastRow; ++y) {
+        auto bits {words[static_cast<size_t>(y) * level.wordsPerRow() + chunk.x]};
+
+        while (bits != 0) {
+            const unsigned int first {static_cast<unsigned int>(std::countr_zero(bits))};
+            const unsigned int length {static_cast<unsigned int>(std::countr_one(bits >> first))};
+            bits &= length + first >= 64 ? 0 : ~std::uint64_t{0} << (first + length);
+
+            const float left {normalize(chunk.x * 64 + first)}, right {normalize(chunk.x * 64 + first + length)};
+            const float bottom {normalize(y)}, top {normalize(y + 1)};
+            const auto offset {run * 4};
+
+            std::ranges::copy(std::array{left, bottom, right, bottom, left, top, right, top}, vertices.begin() + run * 8);
+            std::ranges::copy(
+                std::array{offset, offset + 1, offset + 2, offset + 1, offset + 2, offset + 3}, indices.begin() + run * 6
+            );
+            ++run;
+        }
+    }
+}
+
+std::pair<glm::vec3, glm::vec3> wallChunkBounds(const engine::Level& level, const glm::uvec2& chunk, float height) {
+    const auto size {level.size()};
+    const auto normalize {
+        [size, shift{size / 2}](float coord) -> float {
+            return (coord - shift - 0.5f) / size;
+        }
+    };
+
+    return {
+        glm::vec3{normalize(chunk.x * 64), normalize(chunk.y * 64), 0.0f},
+        glm::vec3{normalize(std::min(size, (chunk.x + 1) * 64)), normalize(std::min(size, (chunk.y + 1) * 64)), height}
+    };
+}
+
+template<typename Segments>
+size_t snakeInstances(
+    const Segments& body, bool skipTailMove, float movingScale, size_t first, size_t count, std::span<glm::mat4> instances
+) {
+    const auto normalize {
+        [boardSize{body.boardSize()}, shift{body.boardSize() / 2}](float coord) -> float {
+            return (coord - shift) / boardSize;
+        }
+    };
+
+    const float movingShift {movingScale / 2};
+    const size_t last {std::min(first + count, body.size())};
+    size_t written {0};
+
+    if (first == 0 && last > 0) {
+        const auto [head, headDirection] {body.front()};
+
+        instances[written++] = glm::scale(
+            glm::translate(glm::mat4(1.0f), glm::vec3{
+                normalize(
+                    head.x
+                        + (headDirection == Direction::Right ? movingShift - 0.5f : 0)
+                        + (headDirection == Direction::Left ? - movingShift + 0.5f : 0)
+                ),
+                normalize(
+                    head.y
+                        + (headDirection == Direction::Up ? movingShift - 0.5f : 0)
+                        + (headDirection == Direction::Down ? - movingShift + 0.5f : 0)
+                ),
+                0.0f
+            }),
+            glm::vec3{
+                (headDirection == Direction::Right || headDirection == Direction::Left) ? movingScale : 1.0f,
+                (headDirection == Direction::Up || headDirection == Direction::Down) ? movingScale : 1.0f,
+                1.0f
+            }
+        );
+    }
+
+    for (size_t segment = std::max<size_t>(first, 1); segment < last && segment + 1 < body.size(); ++segment) {
+        const auto cell {body.cell(segment)};
+        instances[written++] = glm::translate(
+            glm::mat4(1.0f),
+            glm::vec3{normalize(cell.x), normalize(cell.y), 0.0f}
+        );
+    }
+
+    if (last == body.size() && body.size() > 1) {
+        const auto tail {body.cell(body.size() - 1)};
+        const auto lastDirection {body.direction(body.size() - 2)};
+
+        if (skipTailMove) {
+            instances[written++] = glm::scale(
+                glm::translate(
+                    glm::mat4(1.0f),
+                    glm::vec3{normalize(tail.x), normalize(tail.y), 0.0f}
+                ),
+                glm::vec3{1.0f, 1.0f, 1.0f}
+            );
+        } else {
+            instances[written++] = glm::scale(
+                glm::translate(
+                    glm::mat4(1.0f),
+                    glm::vec3{
+                        normalize(
+                            tail.x
+                                + (lastDirection == Direction::Right ? movingShift : 0)
+                                + (lastDirection == Direction::Left ? -movingShift : 0)
+                        ),
+                        normalize(
+                            tail.y
+                                + (lastDirection == Direction::Up ? movingShift : 0)
+                                + (lastDirection == Direction::Down ? -movingShift : 0)
+                        ),
+                        0.0f
+                    }
+                ),
+                glm::vec3{
+                    (lastDirection == Direction::Right || lastDirection == Direction::Left) ? 1.0f - movingScale : 1.0f,
+                    (lastDirection == Direction::Up || lastDirection == Direction::Down) ? 1.0f - movingScale : 1.0f,
+                    1.0f
+                }
+            );
+        }
+    }
+
+    return written;
+}
+
+template<typename Segments>
+std::pair<glm::vec3, glm::vec3> snakeBounds(const Segments& body, size_t first, size_t count) {
+    const float boardSize {static_cast<float>(body.boardSize())};
+    const float shift {static_cast<float>(body.boardSize() / 2)};
+    const size_t last {std::min(first + count, body.size())};
+
+    glm::uvec2 min {body.cell(first)};
+    glm::uvec2 max {min};
+    for (size_t segment = first + 1; segment < last; ++segment) {
+        const auto cell {body.cell(segment)};
+        min = glm::min(min, cell);
+        max = glm::max(max, cell);
+    }
+
+    // a cell of margin covers the cube size and the gliding head and tail, runs across the edge span the board
+    return {
+        glm::vec3{(glm::vec2{min} - shift - 1.0f) / boardSize, -1.0f / boardSize},
+        glm::vec3{(glm::vec2{max} - shift + 1.0f) / boardSize, 1.0f / boardSize}
+    };
+}
+
+template<typename Segments>
+VisibleSnake visibleSnakeInstances(
+    const Segments& body, bool skipTailMove, float movingScale, const util::Frustum& frustum,
+    size_t runLength, size_t runsPerJob, util::FrameArena& arena, util::JobSystem& jobs
+) {
+    if (body.size() == 0) {
+        return {{}, 0, 0};
+    }
+
+    // offsets[run + 1] is first the size of the run in view, then where the run after it goes
+    const auto runs {(body.size() - 1 + runLength - 1) / runLength};
+    const auto offsets {arena.allocate<size_t>(runs + 1)};
+    jobs.parallelFor(runs, runsPerJob, [&](size_t begin, size_t end) {
+        for (size_t run = begin; run < end; ++run) {
+            const auto first {1 + run * runLength};
+            const auto [min, max] {snakeBounds(body, first, runLength)};
+            offsets[run + 1] = frustum.intersects(min, max) ? std::min(runLength, body.size() - first) : 0;
+        }
+    });
+
+    VisibleSnake snake {{}, 0, 0};
+    offsets[0] = 1;
+    for (size_t run = 0; run < runs; ++run) {
+        if (offsets[run + 1] > 0) {
+            ++snake.visibleRuns;
+        } else {
+            ++snake.culledRuns;
+        }
+        offsets[run + 1] += offsets[run];
+    }
+
+    const auto instances {arena.allocate<glm::mat4>(offsets[runs])};
+    snakeInstances(body, skipTailMove, movingScale, 0, 1, instances);
+    jobs.parallelFor(runs, runsPerJob, [&](size_t begin, size_t end) {
+        for (size_t run = begin; run < end; ++run) {
+            if (offsets[run + 1] > offsets[run]) {
+                const auto span {instances.subspan(offsets[run], offsets[run + 1] - offsets[run])};
+                snakeInstances(body, skipTailMove, movingScale, 1 + run * runLength, runLength, span);
+            }
+        }
+    });
+
+    snake.instances = instances;
+    return snake;
+}
+
+template size_t snakeInstances(const engine::Body&, bool, float, size_t, size_t, std::span<glm::mat4>);
+template size_t snakeInstances(const engine::StateRing::Snapshot&, bool, float, size_t, size_t, std::span<glm::mat4>);
+template std::pair<glm::vec3, glm::vec3> snakeBounds(const engine::Body&, size_t, size_t);
+template std::pair<glm::vec3, glm::vec3> snakeBounds(const engine::StateRing::Snapshot&, size_t, size_t);
+template VisibleSnake visibleSnakeInstances(
+    const engine::Body&, bool, float, const util::Frustum&, size_t, size_t, util::FrameArena&, util::JobSystem&
+);
+template VisibleSnake visibleSnakeInstances(
+    const engine::StateRing::Snapshot&, bool, float, const util::Frustum&, size_t, size_t, util::FrameArena&, util::JobSystem&
+);
+
+float projectedCellPixels(const glm::mat4& projection, const glm::mat4& view, size_t boardSize, const glm::vec2& viewport) {
+    const auto toPixels {[&](const glm::vec3& point) -> glm::vec2 {
+        const auto clip {projection * view * glm::vec4{point, 1.0f}};
+        return glm::vec2{clip.x, clip.y} / clip.w * viewport / 2.0f;
+    }};
+
+    const float cell {1.0f / boardSize};
+    const auto center {toPixels({0.0f, 0.0f, 0.0f})};
+
+    // the camera turns around the board, the longer side counts
+    return std::max(
+        glm::length(toPixels({cell, 0.0f, 0.0f}) - center),
+        glm::length(toPixels({0.0f, cell, 0.0f}) - center)
+    );
+}
+
+}
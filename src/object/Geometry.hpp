@@ -0,0 +1,75 @@
+#pragma once
+
+#include <engine/Body.hpp>
+#include <engine/Level.hpp>
+#include <engine/StateRing.hpp>
+#include <util/FrameArena.hpp>
+#include <util/Frustum.hpp>
+#include <util/JobSystem.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace app::object {
+
+/*
+ * Vertex and instance data of the board and the snake, kept apart from GL so the benchmarks can time it.
+ */
+
+/// Two triangles per cell of a `size` board, normalized to the board
+std::pair<std::vector<float>, std::vector<unsigned int>> boardVeboData(size_t size);
+
+/// Runs of walls in the rows of the 64x64 cell chunk `chunk`, each is 8 floats and 6 indices of `wallChunkVeboData()`
+size_t wallChunkRuns(const engine::Level& level, const glm::uvec2& chunk);
+
+/**
+ * Two triangles per run of walls in a row of the chunk `chunk` of the level, normalized to the board and aligned
+ * with the snake cubes, into `vertices` and `indices` sized by `wallChunkRuns()`. Reads one word per row straight
+ * from the level bits and allocates nothing, so frames can fill arena storage with it.
+ */
+void wallChunkVeboData(
+    const engine::Level& level, const glm::uvec2& chunk, std::span<float> vertices, std::span<unsigned int> indices
+);
+
+/// Box around the walls of the chunk `chunk` drawn at `height`, normalized like `wallChunkVeboData()`
+std::pair<glm::vec3, glm::vec3> wallChunkBounds(const engine::Level& level, const glm::uvec2& chunk, float height);
+
+/**
+ * Model matrices of the snake cubes `first` to `first + count`, 0 is the head, into `instances` of at least `count`.
+ * `movingScale` is how far the last move is animated, from 0 to 1: the head grows into its cell
+ * and the tail shrinks out of the one it left. Returns the number of matrices written.
+ * `Segments` is an `engine::Body`, or an `engine::StateRing::Snapshot` read in place.
+ */
+template<typename Segments>
+size_t snakeInstances(
+    const Segments& body, bool skipTailMove, float movingScale, size_t first, size_t count, std::span<glm::mat4> instances
+);
+
+/// Box around the cubes `first` to `first + count` of the snake, normalized to the board like `snakeInstances()`
+template<typename Segments>
+std::pair<glm::vec3, glm::vec3> snakeBounds(const Segments& body, size_t first, size_t count);
+
+/// Matrices of the snake cubes in view, and how many runs of segments were culled
+struct VisibleSnake {
+    std::span<const glm::mat4> instances;
+    size_t visibleRuns;
+    size_t culledRuns;
+};
+
+/**
+ * The head, and the runs of `runLength` segments after it whose `snakeBounds()` intersect `frustum`, allocated from `arena`.
+ * The `jobs` cull the runs, `runsPerJob` at a time, then build every visible one in its place after the visible ones before it.
+ */
+template<typename Segments>
+VisibleSnake visibleSnakeInstances(
+    const Segments& body, bool skipTailMove, float movingScale, const util::Frustum& frustum,
+    size_t runLength, size_t runsPerJob, util::FrameArena& arena, util::JobSystem& jobs
+);
+
+/// Pixels a cell of a `boardSize` board covers around the board center, to pick mesh LODs
+float projectedCellPixels(const glm::mat4& projection, const glm::mat4& view, size_t boardSize, const glm::vec2& viewport);
+
+}
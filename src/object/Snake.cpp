@@ -1,19 +1,25 @@
 #include "Snake.hpp"
+#include <util/Trace.hpp>
 #include <object/Board.hpp>
+#include <object/Geometry.hpp>
 #include <object/Treat.hpp>
 #include <glad/glad.h>
-#include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
-#include <stdexcept>
 #include <gsl/util>
-#include <limits>
-#include <util/Cube.hpp>
+#include <util/FramePacket.hpp>
+#include <util/FrameStats.hpp>
+#include <util/JobSystem.hpp>
+#include <util/Metrics.hpp>
 #include <algorithm>
+#include <bit>
+#include <stdexcept>
 
 namespace app::object {
 
+using engine::Direction;
+
 //region Static Variables
 
 std::chrono::milliseconds Snake::mMoveInterval {300};
@@ -22,58 +28,180 @@ std::chrono::milliseconds Snake::mMoveInterval {300};
 
 //region Constructor & Destructor
 
-Snake::Snake(gsl::not_null<Board *> board, gsl::not_null<Treat *> treat)
+Snake::Snake(gsl::not_null<Board *> board, gsl::not_null<Treat *> treat, util::InputLatency* latency)
+    : Snake{board, treat, latency, nullptr}
+{
+}
+
+Snake::Snake(gsl::not_null<Board *> board, gsl::not_null<Treat *> treat, std::shared_ptr<const engine::StateRing> ring)
+    : Snake{board, treat, nullptr, std::move(ring)}
+{
+}
+
+Snake::Snake(
+    gsl::not_null<Board *> board, gsl::not_null<Treat *> treat, util::InputLatency* latency,
+    std::shared_ptr<const engine::StateRing> ring
+)
     : mBoard{board}
     , mTreat{treat}
+    , mLatency{latency}
     , mShaderProgram{createShaderProgram()}
-    , mSnake{
-        {{board->size() / 2, 2}, Direction::Up},
-        {{board->size() / 2, 1}, Direction::Up},
-        {{board->size() / 2, 0}, Direction::Up}}
+    , mGame{board->level() ? engine::Game{board->level()} : engine::Game{gsl::narrow_cast<unsigned int>(board->size())}}
+    , mHead{util::Mesh::find("head", segmentCube())}
+    , mSegment{util::Mesh::find("segment", segmentCube())}
 {
-    createVao();
+    createInstanceBuffer();
+
+    int viewport[4] {};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    mViewport = {viewport[2], viewport[3]};
+
+    // meshes are modeled in cells, the board is 1 across
+    glUseProgram(mShaderProgram.id());
+    mShaderProgram.setUniform("cellSize", 1.0f / mBoard->size());
+    glUseProgram(0);
+
+    mTreat->setTreats(mGame.treats().treats());
+
+    if (ring) {
+        if (ring->boardSize() != board->size()) {
+            throw std::runtime_error{"State ring is for another board"};
+        }
+
+        mRing = std::move(ring);
+        follow();
+    } else if (!mGame.level()) {
+        // the cycle may be generated and written on a first run, which no tick should wait for
+        mCycle = engine::HamiltonianCycle::load(mGame.boardSize(), engine::HamiltonianCycle::defaultCacheDirectory());
+    }
 }
 
 Snake::~Snake() noexcept {
-    glBindVertexArray(0);
-    glDeleteVertexArrays(1, &mVao);
-    glDeleteBuffers(1, &mVbo);
-    glDeleteBuffers(1, &mEbo);
     glDeleteBuffers(1, &mInstanceVBO);
-    glDeleteBuffers(1, &mColorVBO);
 }
 
 //endregion
 
 //region Public Methods
 
-void Snake::tick(const std::set<int> &pressedKeys) {
-    updateNextDirection(pressedKeys);
+void Snake::tick(const input::Input& input) {
+    if (mRing) {
+        follow();
+        return;
+    }
+
+    const bool playing {!mAutopilot.has_value() && !mSolver.has_value() && !mSearch};
+
+    // every press in order: R starts a new game, P pauses, A/H/M toggle the bots, arrows queue turns
+    for (const auto& event : input.events()) {
+        if (!event.pressed) {
+            continue;
+        }
 
-    if (
-        std::chrono::system_clock::now() - mLastMoveTime
-        >=
-        mMoveInterval / (pressedKeys.find(GLFW_KEY_LEFT_SHIFT) != pressedKeys.end() ? 3 : 1)
-    ) {
+        switch (event.action) {
+            case input::Action::Restart: reset(); break;
+            case input::Action::Pause: togglePause(); break;
+            case input::Action::Autopilot: toggleAutopilot(); break;
+            case input::Action::Hamiltonian: toggleSolver(); break;
+            case input::Action::MonteCarlo: toggleSearch(); break;
+            case input::Action::Up: if (playing) mTurns.push(Direction::Up, mGame.direction(), event.time); break;
+            case input::Action::Down: if (playing) mTurns.push(Direction::Down, mGame.direction(), event.time); break;
+            case input::Action::Left: if (playing) mTurns.push(Direction::Left, mGame.direction(), event.time); break;
+            case input::Action::Right: if (playing) mTurns.push(Direction::Right, mGame.direction(), event.time); break;
+            default: break;
+        }
+    }
+
+    mBoost = input.isHeld(input::Action::Boost);
+
+    if (const auto tickTime {nextTickTime()}; tickTime.has_value() && std::chrono::steady_clock::now() >= tickTime.value()) {
         move();
     }
 }
 
-void Snake::render() {
-    glUseProgram(mShaderProgram.id());
+std::optional<std::chrono::steady_clock::time_point> Snake::nextTickTime() const {
+    // paused or over, only keys can change that; a followed game ticks when its publisher moves
+    if (mRing || mGame.state() != engine::GameState::Running) {
+        return std::nullopt;
+    }
 
-    if (mPendingCameraUpdate.has_value()) {
-        mShaderProgram.setUniform("view", mPendingCameraUpdate.value());
-        mPendingCameraUpdate.reset();
+    return mLastMoveTime + mMoveInterval / (mBoost ? 3 : 1);
+}
+
+std::optional<std::chrono::steady_clock::time_point> Snake::nextFrameTime() const {
+    // the body glides between moves while the game runs
+    if (mDirty || state() == engine::GameState::Running) {
+        return std::chrono::steady_clock::time_point::min();
+    }
+    if (mPendingCameraUpdate.has_value() || mPendingProjectionUpdate.has_value()) {
+        return std::chrono::steady_clock::time_point::min();
+    }
+
+    // paused or over, the last move still finishes gliding
+    if (const auto settled {mLastMoveTime + moveInterval()}; mLastRenderTime < settled) {
+        return settled;
+    }
+
+    return std::nullopt;
+}
+
+void Snake::reset() {
+    mGame.reset(std::random_device{}());
+    mTreat->setTreats(mGame.treats().treats());
+    mLastMoveTime = std::chrono::steady_clock::now();
+    mTurns.clear();
+    mDirty = true;
+
+    if (mAutopilot.has_value()) {
+        mAutopilot->reset();
     }
-    if (mPendingProjectionUpdate.has_value()) {
-        mShaderProgram.setUniform("projection", mPendingProjectionUpdate.value());
+}
+
+void Snake::prepare(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) {
+    TRACE_ZONE("Snake::prepare");
+
+    mDirty = false;
+    mLastRenderTime = std::chrono::steady_clock::now();
+
+    const bool cameraChanged {mPendingCameraUpdate.has_value() || mPendingProjectionUpdate.has_value()};
+    if (cameraChanged) {
+        mView = mPendingCameraUpdate.value_or(mView);
+        mProjection = mPendingProjectionUpdate.value_or(mProjection);
+        mPendingCameraUpdate.reset();
         mPendingProjectionUpdate.reset();
+        mFrustum = util::Frustum{mProjection * mView};
+
+        const auto cellPixels {projectedCellPixels(mProjection, mView, mBoard->size(), mViewport)};
+        mHeadLod = mHead.lodFor(cellPixels);
+        mSegmentLod = mSegment.lodFor(cellPixels);
     }
 
-    renderSnake();
+    const auto snake {prepareInstances(frame, stats, jobs)};
 
-    glUseProgram(0);
+    frame.record([this, cameraChanged, view{mView}, projection{mProjection}, snake, headLod{mHeadLod}, segmentLod{mSegmentLod}] {
+        glUseProgram(mShaderProgram.id());
+        if (cameraChanged) {
+            mShaderProgram.setUniform("view", view);
+            mShaderProgram.setUniform("projection", projection);
+        }
+
+        if (!snake.empty()) {
+            glBindBuffer(GL_ARRAY_BUFFER, mInstanceVBO);
+            if (snake.size() > mInstanceCapacity) {
+                // same buffer name, the vertex array bindings stay valid
+                mInstanceCapacity = std::bit_ceil(snake.size());
+                glBufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * mInstanceCapacity, NULL, GL_DYNAMIC_DRAW);
+            }
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(glm::mat4) * snake.size(), snake.data());
+            util::metrics::uploadBytes.add(sizeof(glm::mat4) * snake.size());
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+            mHead.draw(headLod);
+            mSegment.draw(segmentLod, snake.size() - 1);
+        }
+
+        glUseProgram(0);
+    });
 }
 
 IObject& Snake::setCamera(const glm::mat4 &view) {
@@ -102,12 +230,13 @@ layout (location = 2) in mat4 model;
 
 uniform mat4 view;
 uniform mat4 projection;
+uniform float cellSize;
 
 out vec3 vertexColor;
 
 void main() {
     vertexColor = color;
-    gl_Position = projection * view * model * vec4(pos, 1.0);
+    gl_Position = projection * view * model * vec4(pos * cellSize, 1.0);
 }
 )";
 
@@ -126,256 +255,165 @@ void main() {
     return util::ShaderProgram{vertexShaderSource, fragmentShaderSource};
 }
 
-void Snake::createVao() {
-    auto [vertices, indices] = util::Cube::indexed();
-
-    const float colors[] = {
-        0.7f, 0.321f, 0.129f,
-        0.7f, 0.321f, 0.129f,
-        0.7f, 0.321f, 0.129f,
-        0.7f, 0.321f, 0.129f,
-
-        0.9f, 0.701f, 0.231f,
-        0.9f, 0.701f, 0.231f,
-        0.9f, 0.701f, 0.231f,
-        0.9f, 0.701f, 0.231f,
-    };
-
-    // normalize to board cell size
-    std::for_each(vertices.begin(), vertices.end(), [size{mBoard->size()}](float& value){ value /= size; });
-
-    unsigned int vbo, ebo, vao, instanceVbo, colorVbo;
-    glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
-    glGenBuffers(1, &ebo);
-    glGenBuffers(1, &instanceVbo);
-    glGenBuffers(1, &colorVbo);
-
-    glBindVertexArray(vao);
-
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(), indices.data(), GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-    }
+util::Mesh Snake::segmentCube() {
+    return util::Mesh::cube({0.7f, 0.321f, 0.129f}, {0.9f, 0.701f, 0.231f});
+}
 
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, colorVbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), colors, GL_STATIC_DRAW);
+void Snake::createInstanceBuffer() {
+    glGenBuffers(1, &mInstanceVBO);
 
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(1);
-    }
+    // the whole board on common sizes, large levels grow it when the GL thread draws them
+    mInstanceCapacity = std::min<size_t>(mBoard->size() * mBoard->size(), 64 * 1024);
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * mInstanceCapacity, NULL, GL_DYNAMIC_DRAW);
 
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(glm::mat4) * std::pow(mBoard->size(), 2), NULL, GL_DYNAMIC_DRAW);
+    // the head is the first instance, the segments read from the second one on
+    for (const auto& [mesh, offset] : {std::pair{&mHead, size_t{0}}, std::pair{&mSegment, sizeof(glm::mat4)}}) {
+        glBindVertexArray(mesh->vao());
 
         for (size_t i = 0; i < 4; ++i) {
             const size_t index {i + 2};
-            glVertexAttribPointer(index, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void *) (sizeof(float) * 4 * i));
+            glVertexAttribPointer(index, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void *) (offset + sizeof(float) * 4 * i));
             glVertexAttribDivisor(index, 1);
             glEnableVertexAttribArray(index);
         }
     }
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
 
-    mVao = vao;
-    mVbo = vbo;
-    mEbo = ebo;
-    mInstanceVBO = instanceVbo;
-    mColorVBO = colorVbo;
+void Snake::togglePause() {
+    mDirty = true;
 
-    mIndicesCount = indices.size();
+    if (mGame.state() == engine::GameState::Paused) {
+        mGame.setPaused(false);
+        mLastMoveTime = std::chrono::steady_clock::now();
+    } else {
+        mGame.setPaused(true);
+    }
 }
 
-void Snake::updateNextDirection(const std::set<int> &pressedKeys) {
-    if (pressedKeys.find(GLFW_KEY_UP) != pressedKeys.end() && mDirection != Direction::Down) {
-        mNextDirection = Direction::Up;
-    } else if (pressedKeys.find(GLFW_KEY_DOWN) != pressedKeys.end() && mDirection != Direction::Up) {
-        mNextDirection = Direction::Down;
-    } else if (pressedKeys.find(GLFW_KEY_LEFT) != pressedKeys.end() && mDirection != Direction::Right) {
-        mNextDirection = Direction::Left;
-    } else if (pressedKeys.find(GLFW_KEY_RIGHT) != pressedKeys.end() && mDirection != Direction::Left) {
-        mNextDirection = Direction::Right;
+void Snake::toggleAutopilot() {
+    if (mAutopilot.has_value()) {
+        mAutopilot.reset();
+    } else {
+        mAutopilot.emplace(mGame.boardSize());
+        mSolver.reset();
+        mSearch.reset();
+        mTurns.clear();
     }
 }
 
-void Snake::move() {
-    mLastMoveTime = std::chrono::system_clock::now();
-    mDirection = mNextDirection;
-
-    const auto nextHead {getNextHead()};
-
-    if (const auto& treatPos {mTreat->position()}; nextHead.x == treatPos.x && nextHead.y == treatPos.y) {
-        mSkipTailMove = true;
-        mSnake.pop_back();
-        mSnake.push_front({nextHead, mDirection});
-
-        if (mSnake.size() == std::pow(mBoard->size(), 2)) {
-            throw std::runtime_error{"Win!"};
-        }
-
-        do {
-            const auto& treatPos = mTreat->randomizePosition();
-        } while (
-            std::any_of(mSnake.begin(), mSnake.end(), [&treatPos](const auto& cell){
-                return cell.first.x == treatPos.x && cell.first.y == treatPos.y;
-            })
-        );
-    } else {
-        if (mSkipTailMove) {
-            mSkipTailMove = false;
-        } else {
-            mSnake.pop_back();
-        }
+void Snake::toggleSolver() {
+    if (mSolver.has_value()) {
+        mSolver.reset();
+        return;
+    }
 
-        if (std::any_of(mSnake.begin(), mSnake.end(), [&nextHead](const auto &cell) {
-            return cell.first.x == nextHead.x && cell.first.y == nextHead.y;
-        })) {
-            throw std::runtime_error{"Bump"};
-        }
+    // the Hamiltonian cycle player can take over only while the body follows the cycle, which walls cut
+    if (!mCycle) {
+        return;
+    }
+    engine::HamiltonianSolver solver {mCycle};
 
-        mSnake.push_front({nextHead, mDirection});
+    if (solver.isAligned(mGame)) {
+        mSolver.emplace(std::move(solver));
+        mAutopilot.reset();
+        mSearch.reset();
+        mTurns.clear();
     }
 }
 
-glm::uvec2 Snake::getNextHead() const {
-    glm::uvec2 nextHead {
-        mSnake.front().first.x + getMoveX(mDirection),
-        mSnake.front().first.y + getMoveY(mDirection)
-    };
-
-    if (nextHead.x == std::numeric_limits<unsigned int>::max()) {
-        nextHead.x = mBoard->size() - 1;
-    } else if (nextHead.x == mBoard->size()) {
-        nextHead.x = 0;
+void Snake::toggleSearch() {
+    if (mSearch) {
+        mSearch.reset();
+    } else if (mGame.boardSize() <= engine::MonteCarloSearch::State::maxBoardSize && !mGame.level() && mGame.treatCount() == 1) {
+        // the rollouts play `CompactGame`, which knows a single treat
+        mSearch = std::make_unique<engine::MonteCarloSearch>();
+        mAutopilot.reset();
+        mSolver.reset();
+        mTurns.clear();
     }
+}
 
-    if (nextHead.y == std::numeric_limits<unsigned int>::max()) {
-        nextHead.y = mBoard->size() - 1;
-    } else if (nextHead.y == mBoard->size()) {
-        nextHead.y = 0;
+void Snake::setTreatCount(size_t count) {
+    mGame.setTreatCount(count);
+    if (count > 1) {
+        mSearch.reset();
     }
-
-    return nextHead;
+    mTreat->setTreats(mGame.treats().treats());
+    mDirty = true;
 }
 
-int Snake::getMoveX(Direction direction) {
-    return (direction == Direction::Right) - (direction == Direction::Left);
+void Snake::move() {
+    mLastMoveTime = std::chrono::steady_clock::now();
+    mDirty = true;
+
+    const auto head {mGame.body().cell(0)};
+
+    if (mAutopilot.has_value()) {
+        mGame.setNextDirection(mAutopilot->decide(mGame));
+    } else if (mSolver.has_value()) {
+        mGame.setNextDirection(mSolver->decide(mGame));
+    } else if (mSearch) {
+        mGame.setNextDirection(mSearch->decide(mGame));
+    } else if (const auto turn {mTurns.pop()}; turn.has_value()) {
+        mGame.setNextDirection(turn->direction);
+
+        if (mLatency != nullptr) {
+            mLatency->moved(turn->time, mLastMoveTime);
+        }
+    }
+    mGame.move();
+    util::metrics::moves.add();
+
+    // the tail stays only after eating, and every eaten treat is replaced
+    if (mGame.skipTailMove() && mGame.body().cell(0) != head) {
+        util::metrics::treats.add();
+        mTreat->setTreats(mGame.treats().treats());
+    }
 }
 
-int Snake::getMoveY(Direction direction) {
-    return (direction == Direction::Up) - (direction == Direction::Down);
+void Snake::follow() {
+    const auto version {mRing->published()};
+    if (version == mRemoteVersion) {
+        return;
+    }
+    mRemoteVersion = version;
+    mDirty = true;
+
+    glm::uvec2 treat {};
+    mRing->read([&](const engine::StateRing::Snapshot& snapshot) {
+        treat = snapshot.treat();
+        mRemoteState = snapshot.state();
+        mLastMoveTime = snapshot.movedAt();
+        mRemoteMoveInterval = snapshot.moveInterval();
+    });
+    // the ring carries the first treat only
+    const engine::TreatField::Treat treats[] {{treat, engine::TreatKind::Plain}};
+    mTreat->setTreats(treats);
 }
 
-void Snake::renderSnake() {
-    std::vector<glm::mat4> snake{};
-    snake.reserve(mSnake.size());
+std::span<const glm::mat4> Snake::prepareInstances(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) {
+    const float movingScale {std::min(1.0f, std::chrono::duration<float>(mLastRenderTime - mLastMoveTime) / moveInterval())};
 
-    const auto normalize {
-        [boardSize{mBoard->size()}, shift{mBoard->size() / 2}](float coord) -> float {
-            return (coord - shift) / boardSize;
-        }
-    };
-
-    const float
-        movingScale {1.0f * std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now() - mLastMoveTime
-        ).count() / mMoveInterval.count()},
-        movingShift {movingScale / 2};
-
-    auto snakeIt = mSnake.begin();
-
-    snake.push_back(
-        glm::scale(
-            glm::translate(glm::mat4(1.0f), glm::vec3{
-                normalize(
-                    snakeIt->first.x
-                        + (snakeIt->second == Direction::Right ? movingShift - 0.5f : 0)
-                        + (snakeIt->second == Direction::Left ? - movingShift + 0.5f : 0)
-                ),
-                normalize(
-                    snakeIt->first.y
-                        + (snakeIt->second == Direction::Up ? movingShift - 0.5f : 0)
-                        + (snakeIt->second == Direction::Down ? - movingShift + 0.5f : 0)
-                ),
-                0.0f
-            }),
-            glm::vec3{
-                (snakeIt->second == Direction::Right || snakeIt->second == Direction::Left) ? movingScale : 1.0f,
-                (snakeIt->second == Direction::Up || snakeIt->second == Direction::Down) ? movingScale : 1.0f,
-                1.0f
-            }
-        )
-    );
-
-    ++snakeIt;
-
-    for (const auto end = mSnake.end() - 1; snakeIt != end; ++snakeIt) {
-        snake.push_back(
-            glm::translate(
-                glm::mat4(1.0f),
-                glm::vec3{normalize(snakeIt->first.x), normalize(snakeIt->first.y), 0.0f}
-            )
-        );
-    }
+    // the head is always drawn, the segments after it in runs of `chunkSegments`, only those in view
+    VisibleSnake snake {};
+    const auto build {[&](const auto& body, bool skipTailMove) {
+        snake = visibleSnakeInstances(body, skipTailMove, movingScale, mFrustum, chunkSegments, runsPerJob, frame.arena(), jobs);
+    }};
 
-    const auto lastDirection {(snakeIt - 1)->second};
-
-    if (mSkipTailMove) {
-        snake.push_back(
-            glm::scale(
-                glm::translate(
-                    glm::mat4(1.0f),
-                    glm::vec3{normalize(snakeIt->first.x), normalize(snakeIt->first.y), 0.0f}
-                ),
-                glm::vec3{1.0f, 1.0f, 1.0f}
-            )
-        );
+    // a remote body is read where it was published, built again if the publisher got to its slot meanwhile
+    if (mRing) {
+        mRing->read([&](const engine::StateRing::Snapshot& snapshot) { build(snapshot, snapshot.skipTailMove()); });
     } else {
-        snake.push_back(
-            glm::scale(
-                glm::translate(
-                    glm::mat4(1.0f),
-                    glm::vec3{
-                        normalize(
-                            snakeIt->first.x
-                                + (lastDirection == Direction::Right ? movingShift : 0)
-                                + (lastDirection == Direction::Left ? -movingShift : 0)
-                        ),
-                        normalize(
-                            snakeIt->first.y
-                                + (lastDirection == Direction::Up ? movingShift : 0)
-                                + (lastDirection == Direction::Down ? -movingShift : 0)
-                        ),
-                        0.0f
-                    }
-                ),
-                glm::vec3{
-                    (lastDirection == Direction::Right || lastDirection == Direction::Left) ? 1.0f - movingScale : 1.0f,
-                    (lastDirection == Direction::Up || lastDirection == Direction::Down) ? 1.0f - movingScale : 1.0f,
-                    1.0f
-                }
-            )
-        );
+        build(mGame.body(), mGame.skipTailMove());
     }
+    stats.frame().snakeChunks.visible += snake.visibleRuns;
+    stats.frame().snakeChunks.culled += snake.culledRuns;
 
-    glBindBuffer(GL_ARRAY_BUFFER, mInstanceVBO);
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(glm::mat4) * snake.size(), snake.data());
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-    glBindVertexArray(mVao);
-    glDrawElementsInstanced(GL_TRIANGLES, mIndicesCount, GL_UNSIGNED_INT, 0, snake.size());
-    glBindVertexArray(0);
+    return snake.instances;
 }
 
 //endregion
@@ -3,12 +3,22 @@
 #include <interface/IObject.hpp>
 #include <gsl/pointers>
 #include <array>
-#include <deque>
 #include <chrono>
+#include <util/Frustum.hpp>
+#include <util/GpuMesh.hpp>
 #include <util/ShaderProgram.hpp>
-#include <glm/vec2.hpp>
+#include <util/InputLatency.hpp>
+#include <engine/Game.hpp>
+#include <engine/Autopilot.hpp>
+#include <engine/HamiltonianSolver.hpp>
+#include <engine/MonteCarloSearch.hpp>
+#include <engine/StateRing.hpp>
+#include <engine/TurnQueue.hpp>
+#include <input/Input.hpp>
 #include <vector>
+#include <memory>
 #include <optional>
+#include <span>
 
 namespace app::object {
 
@@ -17,7 +27,10 @@ class Treat;
 
 class Snake : public IObject {
 public:
-    explicit Snake(gsl::not_null<Board*> board, gsl::not_null<Treat*> treat);
+    /// `latency` follows the turns typed on the keyboard to the screen, when set
+    explicit Snake(gsl::not_null<Board*> board, gsl::not_null<Treat*> treat, util::InputLatency* latency = nullptr);
+    /// Draws the game another process publishes to `ring`, in place, and plays none itself
+    explicit Snake(gsl::not_null<Board*> board, gsl::not_null<Treat*> treat, std::shared_ptr<const engine::StateRing> ring);
 
     Snake(Snake &&other) noexcept = default;
     Snake & operator=(Snake &&other) noexcept = default;
@@ -25,49 +38,82 @@ public:
 
     IObject& setCamera(const glm::mat4 &view) override;
     IObject& setProjection(const glm::mat4 &projection) override;
-    void render() override;
+    void prepare(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) override;
 
-    void tick(const std::set<int> &pressedKeys) override;
+    void tick(const input::Input& input) override;
+    std::optional<std::chrono::steady_clock::time_point> nextTickTime() const override;
+    std::optional<std::chrono::steady_clock::time_point> nextFrameTime() const override;
 
-private:
-    enum class Direction {Up, Down, Left, Right};
+    inline engine::GameState state() const {
+        return mRing ? mRemoteState : mGame.state();
+    }
+    /// New game on the same board, keeps the GL resources
+    void reset();
+    /// Treats on the board at once, kept for later games. Throws when the board has no room for them
+    void setTreatCount(size_t count);
 
 private:
+    explicit Snake(
+        gsl::not_null<Board*> board, gsl::not_null<Treat*> treat, util::InputLatency* latency,
+        std::shared_ptr<const engine::StateRing> ring
+    );
+
     util::ShaderProgram createShaderProgram();
-    void createVao();
-    void updateNextDirection(const std::set<int> &pressedKeys);
+    static util::Mesh segmentCube();
+    void createInstanceBuffer();
+    void togglePause();
+    void toggleAutopilot();
+    void toggleSolver();
+    void toggleSearch();
     void move();
-    glm::uvec2 getNextHead() const;
-    void renderSnake();
-
-    static int getMoveX(Direction direction);
-    static int getMoveY(Direction direction);
+    /// Takes the treat and the timing of the last move when the ring has a new state
+    void follow();
+    inline std::chrono::steady_clock::duration moveInterval() const {
+        return mRing ? mRemoteMoveInterval : std::chrono::steady_clock::duration{mMoveInterval};
+    }
+    /// Matrices of the head and the segments in view, in `frame`
+    std::span<const glm::mat4> prepareInstances(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs);
 
 private:
     Board* mBoard;
     Treat* mTreat;
+    util::InputLatency* mLatency;
     util::ShaderProgram mShaderProgram;
 
-    std::deque<std::pair<glm::uvec2, Direction>> mSnake;
+    engine::Game mGame;
+    engine::TurnQueue mTurns;
+    std::optional<engine::Autopilot> mAutopilot;
+    std::optional<engine::HamiltonianSolver> mSolver;
+    std::shared_ptr<const engine::HamiltonianCycle> mCycle; // loaded up front, null with walls
+    std::unique_ptr<engine::MonteCarloSearch> mSearch;
 
-    Direction mDirection{Direction::Up};
-    Direction mNextDirection{Direction::Up};
+    std::shared_ptr<const engine::StateRing> mRing;
+    std::uint64_t mRemoteVersion {0};
+    engine::GameState mRemoteState {engine::GameState::Paused};
+    std::chrono::steady_clock::duration mRemoteMoveInterval {};
 
-    unsigned int mVao;
-    unsigned int mVbo;
-    unsigned int mEbo;
+    util::GpuMesh mHead;
+    util::GpuMesh mSegment;
     unsigned int mInstanceVBO;
-    unsigned int mColorVBO;
+    size_t mInstanceCapacity {0}; // of the GL thread
 
-    unsigned int mIndicesCount;
+    glm::mat4 mView {1.0f};
+    glm::mat4 mProjection {1.0f};
+    util::Frustum mFrustum;
+    glm::vec2 mViewport {};
+    size_t mHeadLod {0};
+    size_t mSegmentLod {0};
 
+    static constexpr size_t chunkSegments {64}; // culled together
+    static constexpr size_t runsPerJob {16};
     static std::chrono::milliseconds mMoveInterval;
-    std::chrono::system_clock::time_point mLastMoveTime {std::chrono::system_clock::now()};
+    std::chrono::steady_clock::time_point mLastMoveTime {std::chrono::steady_clock::now()};
+    std::chrono::steady_clock::time_point mLastRenderTime {};
+    bool mBoost {false};
+    bool mDirty {true};
 
     std::optional<glm::mat4> mPendingCameraUpdate;
     std::optional<glm::mat4> mPendingProjectionUpdate;
-
-    bool mSkipTailMove {false};
 };
 
 }
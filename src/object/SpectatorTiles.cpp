@@ -0,0 +1,78 @@
+#include "SpectatorTiles.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace app::object {
+
+//region Constructor & Destructor
+
+SpectatorTiles::SpectatorTiles(size_t count, unsigned int boardSize, float aspectRatio)
+    : mBoardSize{boardSize}
+{
+    if (count == 0 || count > 0x10000) {
+        throw std::runtime_error{"Invalid tiles count"};
+    }
+
+    // roughly square tiles on the screen
+    const auto columns {std::max(1u, static_cast<unsigned int>(std::ceil(std::sqrt(count * aspectRatio))))};
+    mGrid = {columns, static_cast<unsigned int>((count + columns - 1) / columns)};
+
+    mGames.reserve(count);
+    mPilots.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        mGames.emplace_back(boardSize, mSeed++);
+        mPilots.emplace_back(boardSize);
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+void SpectatorTiles::step() {
+    for (size_t i = 0; i < mGames.size(); ++i) {
+        auto& game {mGames[i]};
+
+        game.setNextDirection(mPilots[i].decide(game));
+        if (game.move() != engine::GameState::Running) {
+            game.reset(mSeed++);
+            mPilots[i].reset();
+        }
+    }
+}
+
+void SpectatorTiles::pack(std::vector<TileInstance>& instances) const {
+    instances.clear();
+
+    for (size_t i = 0; i < mGames.size(); ++i) {
+        const auto& game {mGames[i]};
+        const auto tile {static_cast<std::uint16_t>(i)};
+
+        instances.push_back({0, 0, tile, TileKind::Board});
+
+        const auto& body {game.body()};
+        for (size_t segment = body.size(); segment-- > 0;) {
+            const auto cell {body.cell(segment)};
+            instances.push_back({
+                static_cast<std::uint16_t>(cell.x),
+                static_cast<std::uint16_t>(cell.y),
+                tile,
+                segment == 0 ? TileKind::Head : TileKind::Body
+            });
+        }
+
+        for (const auto& treat : game.treats().treats()) {
+            instances.push_back({
+                static_cast<std::uint16_t>(treat.cell.x),
+                static_cast<std::uint16_t>(treat.cell.y),
+                tile,
+                TileKind::Treat
+            });
+        }
+    }
+}
+
+//endregion
+
+}
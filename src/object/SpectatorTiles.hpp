@@ -0,0 +1,61 @@
+#pragma once
+
+#include <engine/Autopilot.hpp>
+#include <engine/Game.hpp>
+#include <glm/vec2.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace app::object {
+
+enum class TileKind : std::uint16_t {Board, Body, Head, Treat};
+
+/// One instance of the spectator wall draw call, the board instance covers the whole tile
+struct TileInstance {
+    std::uint16_t x;
+    std::uint16_t y;
+    std::uint16_t tile;
+    TileKind kind;
+};
+static_assert(sizeof(TileInstance) == 8);
+
+/**
+ * Games shown on the spectator wall, played by autopilots and restarted when over.
+ * No GL here: `pack()` flattens every tile into instances, so it is benchmarked headless.
+ */
+class SpectatorTiles {
+public:
+    explicit SpectatorTiles(size_t count, unsigned int boardSize, float aspectRatio = 16 / 9.0f);
+
+    SpectatorTiles(SpectatorTiles &&other) noexcept = default;
+    SpectatorTiles & operator=(SpectatorTiles &&other) noexcept = default;
+    ~SpectatorTiles() noexcept = default;
+
+    /// One move of every game
+    void step();
+    /// Board, body, head and treat instances of all tiles in drawing order, reuses `instances` storage
+    void pack(std::vector<TileInstance>& instances) const;
+
+    inline size_t size() const {
+        return mGames.size();
+    }
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+    /// Columns and rows of tiles
+    inline const glm::uvec2& grid() const {
+        return mGrid;
+    }
+    inline const std::vector<engine::Game>& games() const {
+        return mGames;
+    }
+
+private:
+    unsigned int mBoardSize;
+    glm::uvec2 mGrid;
+    std::vector<engine::Game> mGames;
+    std::vector<engine::Autopilot> mPilots;
+    unsigned int mSeed {1};
+};
+
+}
@@ -0,0 +1,198 @@
+#include "SpectatorWall.hpp"
+#include <util/FramePacket.hpp>
+#include <util/Metrics.hpp>
+#include <util/Trace.hpp>
+#include <glad/glad.h>
+#include <algorithm>
+#include <bit>
+
+namespace app::object {
+
+//region Constructor & Destructor
+
+SpectatorWall::SpectatorWall(size_t tiles, unsigned int boardSize, float aspectRatio)
+    : mTiles{tiles, boardSize, aspectRatio}
+    , mShaderProgram{createShaderProgram()}
+{
+    createVao();
+}
+
+SpectatorWall::~SpectatorWall() noexcept {
+    glBindVertexArray(0);
+    glDeleteVertexArrays(1, &mVao);
+    glDeleteBuffers(1, &mVbo);
+    glDeleteBuffers(1, &mInstanceVbo);
+}
+
+//endregion
+
+//region Public Methods
+
+void SpectatorWall::prepare(util::FramePacket& frame, util::FrameStats&, util::JobSystem&) {
+    TRACE_ZONE("SpectatorWall::prepare");
+
+    mDirty = false;
+    mTiles.pack(mInstances);
+    const auto instances {frame.allocate<TileInstance>(mInstances.size())};
+    std::copy(mInstances.begin(), mInstances.end(), instances.begin());
+
+    frame.record([this, instances, grid{mTiles.grid()}, boardSize{mTiles.boardSize()}] {
+        glBindBuffer(GL_ARRAY_BUFFER, mInstanceVbo);
+        if (instances.size() > mInstanceCapacity) {
+            mInstanceCapacity = std::bit_ceil(instances.size());
+            glBufferData(GL_ARRAY_BUFFER, sizeof(TileInstance) * mInstanceCapacity, nullptr, GL_STREAM_DRAW);
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(TileInstance) * instances.size(), instances.data());
+        util::metrics::uploadBytes.add(sizeof(TileInstance) * instances.size());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        glUseProgram(mShaderProgram.id());
+        mShaderProgram.setUniform("grid", grid);
+        mShaderProgram.setUniform("boardSize", static_cast<float>(boardSize));
+
+        // instances are drawn in order: board first, then the snake and the treat over it
+        glDisable(GL_DEPTH_TEST);
+        glBindVertexArray(mVao);
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instances.size()));
+        glBindVertexArray(0);
+        glEnable(GL_DEPTH_TEST);
+
+        glUseProgram(0);
+    });
+}
+
+IObject& SpectatorWall::setCamera(const glm::mat4 &) {
+    return *this;
+}
+
+IObject& SpectatorWall::setProjection(const glm::mat4 &) {
+    return *this;
+}
+
+void SpectatorWall::tick(const input::Input&) {
+    if (std::chrono::steady_clock::now() >= nextTickTime().value()) {
+        mLastMoveTime = std::chrono::steady_clock::now();
+        mTiles.step();
+        mDirty = true;
+    }
+}
+
+std::optional<std::chrono::steady_clock::time_point> SpectatorWall::nextTickTime() const {
+    return mLastMoveTime + mMoveInterval;
+}
+
+std::optional<std::chrono::steady_clock::time_point> SpectatorWall::nextFrameTime() const {
+    // tiles jump from move to move, nothing to draw in between
+    if (mDirty) {
+        return std::chrono::steady_clock::time_point::min();
+    }
+
+    return std::nullopt;
+}
+
+//endregion
+
+//region Private Methods
+
+util::ShaderProgram SpectatorWall::createShaderProgram() {
+    const char* vertexShaderSource = R"(
+#version 330 core
+
+layout (location = 0) in vec2 corner;
+layout (location = 1) in uvec4 instance; // x, y, tile, kind
+
+uniform uvec2 grid;
+uniform float boardSize;
+
+out vec3 vertexColor;
+out vec2 cellCoord;
+flat out uint kind;
+
+const float margin = 0.04;
+const vec3 colors[4] = vec3[4](
+    vec3(0.280, 0.276, 0.276),
+    vec3(0.7, 0.321, 0.129),
+    vec3(0.9, 0.701, 0.231),
+    vec3(0.262, 0.513, 0.698)
+);
+
+void main() {
+    kind = instance.w;
+    vertexColor = colors[min(kind, 3u)];
+
+    // position inside the tile, the board instance covers all of it
+    vec2 local = kind == 0u ? corner : (vec2(instance.xy) + corner) / boardSize;
+    cellCoord = local * boardSize;
+    local = mix(vec2(margin), vec2(1.0 - margin), local);
+
+    // tile 0 is the top left one, board rows grow upwards
+    vec2 tile = vec2(instance.z % grid.x, grid.y - 1u - instance.z / grid.x);
+    vec2 position = (tile + local) / vec2(grid);
+
+    gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+)";
+
+    const char* fragmentShaderSource = R"(
+#version 330 core
+
+in vec3 vertexColor;
+in vec2 cellCoord;
+flat in uint kind;
+
+out vec4 FragColor;
+
+void main() {
+    // grid lines between board cells
+    vec2 edge = abs(fract(cellCoord) - 0.5);
+    float line = kind == 0u && max(edge.x, edge.y) > 0.45 ? 0.75 : 1.0;
+
+    FragColor = vec4(vertexColor * line, 1.0f);
+}
+)";
+
+    return util::ShaderProgram{vertexShaderSource, fragmentShaderSource};
+}
+
+void SpectatorWall::createVao() {
+    const float corners[] = {
+        0.0f, 0.0f,
+        1.0f, 0.0f,
+        0.0f, 1.0f,
+        1.0f, 1.0f,
+    };
+
+    unsigned int vao, vbo, instanceVbo;
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &instanceVbo);
+
+    glBindVertexArray(vao);
+
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, vbo);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+        glEnableVertexAttribArray(0);
+    }
+
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, instanceVbo);
+
+        glVertexAttribIPointer(1, 4, GL_UNSIGNED_SHORT, sizeof(TileInstance), (void*)0);
+        glVertexAttribDivisor(1, 1);
+        glEnableVertexAttribArray(1);
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    mVao = vao;
+    mVbo = vbo;
+    mInstanceVbo = instanceVbo;
+}
+
+//endregion
+
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <interface/IObject.hpp>
+#include <object/SpectatorTiles.hpp>
+#include <util/ShaderProgram.hpp>
+#include <chrono>
+#include <vector>
+
+namespace app::object {
+
+/**
+ * Many live games in a grid, drawn with one instanced call: every board, segment and treat is
+ * an instance tagged with its tile, and the vertex shader places it in that tile's viewport.
+ * Covers the whole window, the scene camera does not apply.
+ */
+class SpectatorWall : public IObject {
+public:
+    explicit SpectatorWall(size_t tiles, unsigned int boardSize = 13, float aspectRatio = 16 / 9.0f);
+
+    SpectatorWall(SpectatorWall &&other) noexcept = default;
+    SpectatorWall & operator=(SpectatorWall &&other) noexcept = default;
+    ~SpectatorWall() noexcept;
+
+    IObject& setCamera(const glm::mat4 &view) override;
+    IObject& setProjection(const glm::mat4 &projection) override;
+    void prepare(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) override;
+
+    void tick(const input::Input& input) override;
+    std::optional<std::chrono::steady_clock::time_point> nextTickTime() const override;
+    std::optional<std::chrono::steady_clock::time_point> nextFrameTime() const override;
+
+    inline const SpectatorTiles& tiles() const {
+        return mTiles;
+    }
+
+private:
+    util::ShaderProgram createShaderProgram();
+    void createVao();
+
+private:
+    SpectatorTiles mTiles;
+    util::ShaderProgram mShaderProgram;
+
+    unsigned int mVao;
+    unsigned int mVbo;
+    unsigned int mInstanceVbo;
+    size_t mInstanceCapacity {0}; // of the GL thread
+    std::vector<TileInstance> mInstances;
+
+    static constexpr std::chrono::milliseconds mMoveInterval {300};
+    std::chrono::steady_clock::time_point mLastMoveTime {std::chrono::steady_clock::now()};
+    bool mDirty {true};
+};
+
+}
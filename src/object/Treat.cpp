@@ -1,8 +1,11 @@
 #include "Treat.hpp"
-#include <util/Cube.hpp>
+#include <util/Trace.hpp>
 #include <object/Board.hpp>
+#include <object/Geometry.hpp>
+#include <util/FramePacket.hpp>
+#include <util/Metrics.hpp>
 #include <algorithm>
-#include <glm/gtc/matrix_transform.hpp>
+#include <bit>
 
 namespace app::object {
 
@@ -11,16 +14,22 @@ namespace app::object {
 Treat::Treat(gsl::not_null<Board*> board)
     : mBoard{board}
     , mShaderProgram{createShaderProgram()}
+    , mMesh{util::Mesh::find("treat", util::Mesh::cube({0.262f, 0.513f, 0.698f}, {0.654f, 0.8f, 0.905f}))}
 {
-    createVao();
-    setPosition(2, 2);
+    int viewport[4] {};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    mViewport = {viewport[2], viewport[3]};
+
+    // meshes are modeled in cells, the board is 1 across
+    glUseProgram(mShaderProgram.id());
+    mShaderProgram.setUniform("cellSize", 1.0f / mBoard->size());
+    glUseProgram(0);
+
+    createInstanceBuffer();
 }
 
 Treat::~Treat() noexcept {
-    glBindVertexArray(0);
-    glDeleteVertexArrays(1, &mVao);
-    glDeleteBuffers(1, &mVbo);
-    glDeleteBuffers(1, &mEbo);
+    glDeleteBuffers(1, &mInstanceVBO);
 }
 
 //endregion
@@ -39,37 +48,74 @@ IObject& Treat::setProjection(const glm::mat4 &projection) {
     return *this;
 }
 
-void Treat::render() {
-    glUseProgram(mShaderProgram.id());
+void Treat::prepare(util::FramePacket& frame, util::FrameStats&, util::JobSystem&) {
+    TRACE_ZONE("Treat::prepare");
 
-    if (mPendingCameraUpdate.has_value()) {
-        mShaderProgram.setUniform("view", mPendingCameraUpdate.value());
+    const bool cameraChanged {mPendingCameraUpdate.has_value() || mPendingProjectionUpdate.has_value()};
+    if (cameraChanged) {
+        mView = mPendingCameraUpdate.value_or(mView);
+        mProjection = mPendingProjectionUpdate.value_or(mProjection);
         mPendingCameraUpdate.reset();
-    }
-    if (mPendingProjectionUpdate.has_value()) {
-        mShaderProgram.setUniform("projection", mPendingProjectionUpdate.value());
         mPendingProjectionUpdate.reset();
+
+        mLod = mMesh.lodFor(projectedCellPixels(mProjection, mView, mBoard->size(), mViewport));
     }
-    if (mPendingModelUpdate.has_value()) {
-        mShaderProgram.setUniform("model", mPendingModelUpdate.value());
-        mPendingModelUpdate.reset();
+
+    // the buffer keeps the treats of earlier frames until they change
+    std::span<glm::vec3> instances {};
+    if (mInstancesChanged) {
+        instances = frame.allocate<glm::vec3>(mInstances.size());
+        std::ranges::copy(mInstances, instances.begin());
+        mInstancesChanged = false;
     }
 
-    glBindVertexArray(mVao);
-    glDrawElements(GL_TRIANGLES, mIndicesCount, GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
-    glUseProgram(0);
+    frame.record([this, cameraChanged, view{mView}, projection{mProjection}, instances, count{mInstances.size()}, lod{mLod}] {
+        glUseProgram(mShaderProgram.id());
+        if (cameraChanged) {
+            mShaderProgram.setUniform("view", view);
+            mShaderProgram.setUniform("projection", projection);
+        }
+
+        if (!instances.empty()) {
+            glBindBuffer(GL_ARRAY_BUFFER, mInstanceVBO);
+            if (instances.size() > mInstanceCapacity) {
+                // same buffer name, the vertex array binding stays valid
+                mInstanceCapacity = std::bit_ceil(instances.size());
+                glBufferData(GL_ARRAY_BUFFER, sizeof(glm::vec3) * mInstanceCapacity, NULL, GL_DYNAMIC_DRAW);
+            }
+            glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(glm::vec3) * instances.size(), instances.data());
+            util::metrics::uploadBytes.add(sizeof(glm::vec3) * instances.size());
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+
+        if (count > 0) {
+            mMesh.draw(lod, count);
+        }
+        glUseProgram(0);
+    });
 }
 
-const glm::uvec2 &Treat::position() const {
-    return mPosition;
+std::optional<std::chrono::steady_clock::time_point> Treat::nextFrameTime() const {
+    if (mPendingCameraUpdate.has_value() || mPendingProjectionUpdate.has_value() || mInstancesChanged) {
+        return std::chrono::steady_clock::time_point::min();
+    }
+
+    return std::nullopt;
 }
 
-const glm::uvec2 &Treat::randomizePosition() {
-    return setPosition(
-        std::rand() % mBoard->size(),
-        std::rand() % mBoard->size()
-    );
+void Treat::setTreats(std::span<const engine::TreatField::Treat> treats) {
+    const auto boardSize {static_cast<float>(mBoard->size())};
+    const auto shift {static_cast<float>(mBoard->size() / 2)};
+
+    mInstances.resize(treats.size());
+    std::ranges::transform(treats, mInstances.begin(), [boardSize, shift](const auto& treat) {
+        return glm::vec3{
+            (static_cast<float>(treat.cell.x) - shift) / boardSize,
+            (static_cast<float>(treat.cell.y) - shift) / boardSize,
+            static_cast<float>(treat.kind)
+        };
+    });
+    mInstancesChanged = true;
 }
 
 //endregion
@@ -82,16 +128,20 @@ util::ShaderProgram Treat::createShaderProgram() {
 
 layout (location = 0) in vec3 pos;
 layout (location = 1) in vec3 color;
+layout (location = 2) in vec3 treat; // normalized cell, kind
 
 uniform mat4 projection;
 uniform mat4 view;
-uniform mat4 model;
+uniform float cellSize;
 
 out vec3 vertexColor;
 
+// plain, bonus, rare
+const vec3 tints[3] = vec3[3](vec3(1.0), vec3(1.4, 1.1, 0.3), vec3(1.3, 0.45, 1.1));
+
 void main() {
-    vertexColor = color;
-    gl_Position = projection * view * model * vec4(pos, 1.0);
+    vertexColor = min(color * tints[int(treat.z)], vec3(1.0));
+    gl_Position = projection * view * vec4(pos * cellSize + vec3(treat.xy, 0.0), 1.0);
 }
 )";
 
@@ -110,76 +160,20 @@ void main() {
     return util::ShaderProgram{vertexShaderSource, fragmentShaderSource};
 }
 
-void Treat::createVao() {
-    auto [vertices, indices] = util::Cube::indexed();
+void Treat::createInstanceBuffer() {
+    glGenBuffers(1, &mInstanceVBO);
 
-    const float colors[] = {
-        0.262, 0.513, 0.698,
-        0.262, 0.513, 0.698,
-        0.262, 0.513, 0.698,
-        0.262, 0.513, 0.698,
+    mInstanceCapacity = 64;
+    glBindBuffer(GL_ARRAY_BUFFER, mInstanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(glm::vec3) * mInstanceCapacity, NULL, GL_DYNAMIC_DRAW);
 
-        0.654, 0.8, 0.905,
-        0.654, 0.8, 0.905,
-        0.654, 0.8, 0.905,
-        0.654, 0.8, 0.905,
-    };
+    glBindVertexArray(mMesh.vao());
+    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void *) 0);
+    glVertexAttribDivisor(2, 1);
+    glEnableVertexAttribArray(2);
 
-    // normalize to board cell size
-    std::for_each(vertices.begin(), vertices.end(), [size{mBoard->size()}](float& value){ value /= size; });
-
-    unsigned int vbo, ebo, vao, colorVbo;
-    glGenVertexArrays(1, &vao);
-    glGenBuffers(1, &vbo);
-    glGenBuffers(1, &ebo);
-    glGenBuffers(1, &colorVbo);
-
-    glBindVertexArray(vao);
-
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
-
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * indices.size(), indices.data(), GL_STATIC_DRAW);
-
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(0);
-    }
-
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, colorVbo);
-        glBufferData(GL_ARRAY_BUFFER, sizeof(float) * vertices.size(), colors, GL_STATIC_DRAW);
-
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-        glEnableVertexAttribArray(1);
-    }
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
-
-    mVao = vao;
-    mVbo = vbo;
-    mEbo = ebo;
-
-    mIndicesCount = indices.size();
-}
-
-const glm::uvec2& Treat::setPosition(unsigned int x, unsigned int y) {
-    mPosition = {x, y};
-
-    const auto normalize {
-        [boardSize{mBoard->size()}, shift{mBoard->size() / 2}](float coord) -> float {
-            return (coord - shift) / boardSize;
-        }
-    };
-
-    mPendingModelUpdate = glm::translate(glm::mat4(1.0f), glm::vec3{
-        normalize(mPosition.x), normalize(mPosition.y), 0.0f
-    });
-
-    return mPosition;
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
 //endregion
@@ -1,15 +1,20 @@
 #pragma once
 
+#include <engine/TreatField.hpp>
 #include <interface/IObject.hpp>
+#include <util/GpuMesh.hpp>
 #include <util/ShaderProgram.hpp>
 #include <gsl/pointers>
 #include <glm/glm.hpp>
 #include <optional>
+#include <span>
+#include <vector>
 
 namespace app::object {
 
 class Board;
 
+/// Every treat on the board in one instanced draw, tinted by its kind
 class Treat : public IObject {
 public:
     explicit Treat(gsl::not_null<Board*> board);
@@ -20,29 +25,32 @@ public:
 
     IObject& setCamera(const glm::mat4 &view) override;
     IObject& setProjection(const glm::mat4 &projection) override;
-    void render() override;
-    const glm::uvec2& position() const;
-    const glm::uvec2& randomizePosition();
+    void prepare(util::FramePacket& frame, util::FrameStats& stats, util::JobSystem& jobs) override;
+    std::optional<std::chrono::steady_clock::time_point> nextFrameTime() const override;
+    /// Draws these from the next frame on, uploaded only when they change
+    void setTreats(std::span<const engine::TreatField::Treat> treats);
 
 private:
     util::ShaderProgram createShaderProgram();
-    void createVao();
-    const glm::uvec2& setPosition(unsigned int x, unsigned int y);
+    void createInstanceBuffer();
 
 private:
     Board* mBoard;
     util::ShaderProgram mShaderProgram;
-    glm::uvec2 mPosition;
-
-    unsigned int mVao;
-    unsigned int mVbo;
-    unsigned int mEbo;
-
-    unsigned int mIndicesCount;
+    // the normalized cell and the kind of every treat
+    std::vector<glm::vec3> mInstances;
+    bool mInstancesChanged {false};
+    unsigned int mInstanceVBO;
+    size_t mInstanceCapacity {0}; // of the GL thread
+
+    util::GpuMesh mMesh;
+    glm::mat4 mView {1.0f};
+    glm::mat4 mProjection {1.0f};
+    glm::vec2 mViewport {};
+    size_t mLod {0};
 
     std::optional<glm::mat4> mPendingCameraUpdate;
     std::optional<glm::mat4> mPendingProjectionUpdate;
-    std::optional<glm::mat4> mPendingModelUpdate;
 };
 
 }
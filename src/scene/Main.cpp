@@ -1,6 +1,9 @@
 #include "Main.hpp"
 #include <GLFW/glfw3.h>
 #include <interface/IObject.hpp>
+#include <util/FramePacket.hpp>
+#include <util/Metrics.hpp>
+#include <util/Trace.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <iostream>
@@ -12,6 +15,7 @@ namespace app::scene {
 Main::Main()
     : mCamera{glm::lookAt(glm::vec3(0.0f, -0.6f, 1.1f), glm::vec3(0.0f, -0.07f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f))}
     , mProjection{glm::perspective(glm::radians(45.0f), 16/9.0f, 0.1f, 100.0f)}
+    , mJobs{std::make_unique<util::JobSystem>()}
 {}
 
 //endregion
@@ -27,29 +31,61 @@ IScene& Main::add(gsl::not_null<IObject *> object) {
 
 IScene& Main::remove(gsl::not_null<IObject *> object) {
     mObjects.erase(object.get());
+    mInvalidated = true;
 
     return *this;
 }
 
-void Main::tick(const std::set<int> &pressedKeys) {
-    // rotate camera
+void Main::follow(std::shared_ptr<const engine::StateRing> ring) {
+    mRing = std::move(ring);
+    mRingVersion = 0;
+}
+
+void Main::tick(const input::Input& input) {
+    TRACE_ZONE("Main::tick");
+    util::metrics::ticks.add();
+
+    // a published camera replaces the local one, until then the keys move it as usual
+    if (mRing && mRing->published() != mRingVersion) {
+        mRingVersion = mRing->published();
+
+        glm::mat4 camera {};
+        mRing->read([&camera](const engine::StateRing::Snapshot& snapshot) { camera = snapshot.camera(); });
+        if (camera != mRingCamera) {
+            mRingCamera = camera;
+            mCamera = camera;
+            mZoom = 1.0f;
+            for (const auto object : mObjects) {
+                object->setCamera(mCamera);
+            }
+        }
+    }
+
+    // rotate and zoom camera
     do {
-        const bool left {pressedKeys.find(GLFW_KEY_COMMA) != pressedKeys.end()};
-        const bool right {pressedKeys.find(GLFW_KEY_PERIOD) != pressedKeys.end()};
+        const bool left {input.isHeld(input::Action::RotateLeft)};
+        const bool right {input.isHeld(input::Action::RotateRight)};
+        const bool zoomIn {input.isHeld(input::Action::ZoomIn)};
+        const bool zoomOut {input.isHeld(input::Action::ZoomOut)};
 
-        if (!(left ^ right)) {
+        mCameraMoving = (left ^ right) || (zoomIn ^ zoomOut);
+        if (!mCameraMoving) {
             break;
         }
 
-        auto millisecondsAfterLastMove = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now() - mLastCameraMove
-        );
-        if (millisecondsAfterLastMove.count() < 30) {
+        if (std::chrono::steady_clock::now() - mLastCameraMove < mCameraMoveInterval) {
             break;
         }
-        mLastCameraMove = std::chrono::system_clock::now();
+        mLastCameraMove = std::chrono::steady_clock::now();
 
-        mCamera = glm::rotate(mCamera, glm::radians(left ? 1.0f : -1.0f), {0.0f, 0.0f, 1.0f});
+        if (left ^ right) {
+            mCamera = glm::rotate(mCamera, glm::radians(left ? 1.0f : -1.0f), {0.0f, 0.0f, 1.0f});
+        }
+        // magnifies the board around its center
+        if (const float factor {zoomIn ? 1.03f : 1 / 1.03f}; (zoomIn ^ zoomOut) && mZoom * factor >= 1.0f && mZoom * factor <= mMaxZoom) {
+            mZoom *= factor;
+            mCamera = glm::scale(mCamera, glm::vec3{factor});
+        }
 
         for (const auto object : mObjects) {
             object->setCamera(mCamera);
@@ -57,17 +93,60 @@ void Main::tick(const std::set<int> &pressedKeys) {
     } while(false);
 
     for (const auto object : mObjects) {
-        object->tick(pressedKeys);
+        object->tick(input);
     }
 }
 
-void Main::render() {
-    glClearColor(0.180, 0.176, 0.176, 1.0f);
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+std::optional<std::chrono::steady_clock::time_point> Main::nextTickTime() const {
+    std::optional<std::chrono::steady_clock::time_point> next {};
+    if (mCameraMoving) {
+        next = mLastCameraMove + mCameraMoveInterval;
+    }
 
     for (const auto object : mObjects) {
-        object->render();
+        if (const auto objectNext {object->nextTickTime()}; objectNext.has_value() && (!next || *objectNext < *next)) {
+            next = objectNext;
+        }
     }
+
+    return next;
+}
+
+std::optional<std::chrono::steady_clock::time_point> Main::nextFrameTime() const {
+    if (mInvalidated) {
+        return std::chrono::steady_clock::time_point::min();
+    }
+
+    // a camera rotation reaches every object as a pending camera update
+    std::optional<std::chrono::steady_clock::time_point> next {};
+    for (const auto object : mObjects) {
+        if (const auto objectNext {object->nextFrameTime()}; objectNext.has_value() && (!next || *objectNext < *next)) {
+            next = objectNext;
+        }
+    }
+
+    return next;
+}
+
+void Main::invalidate() {
+    mInvalidated = true;
+}
+
+void Main::prepare(util::FramePacket& frame) {
+    TRACE_ZONE("Main::prepare");
+    mInvalidated = false;
+    mFrameStats.beginFrame();
+
+    frame.record([] {
+        glClearColor(0.180, 0.176, 0.176, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    });
+
+    for (const auto object : mObjects) {
+        object->prepare(frame, mFrameStats, *mJobs);
+    }
+
+    mFrameStats.endFrame();
 }
 
 }
\ No newline at end of file
@@ -2,8 +2,13 @@
 
 #include <interface/IScene.hpp>
 #include <set>
+#include <input/Input.hpp>
+#include <util/FrameStats.hpp>
+#include <util/JobSystem.hpp>
+#include <engine/StateRing.hpp>
 #include <glm/glm.hpp>
 #include <chrono>
+#include <memory>
 
 namespace app::scene {
 
@@ -17,14 +22,34 @@ public:
 
     IScene& add(gsl::not_null<IObject *> object) override;
     IScene& remove(gsl::not_null<IObject *> object) override;
-    void render() override;
-    void tick(const std::set<int>& pressedKeys) override;
+    void prepare(util::FramePacket& frame) override;
+    void tick(const input::Input& input) override;
+    std::optional<std::chrono::steady_clock::time_point> nextTickTime() const override;
+    std::optional<std::chrono::steady_clock::time_point> nextFrameTime() const override;
+    void invalidate() override;
+    inline const util::FrameStats& frameStats() const override {
+        return mFrameStats;
+    }
+
+    /// Takes the camera of the states another process publishes to `ring`, the owner ticks on every publish
+    void follow(std::shared_ptr<const engine::StateRing> ring);
 
 private:
     std::set<IObject*> mObjects;
     glm::mat4 mCamera;
     glm::mat4 mProjection;
-    std::chrono::system_clock::time_point mLastCameraMove{std::chrono::system_clock::now()};
+    std::chrono::steady_clock::time_point mLastCameraMove{std::chrono::steady_clock::now()};
+    bool mCameraMoving {false};
+    float mZoom {1.0f};
+    bool mInvalidated {true};
+    std::unique_ptr<util::JobSystem> mJobs;
+    util::FrameStats mFrameStats;
+    std::shared_ptr<const engine::StateRing> mRing;
+    std::uint64_t mRingVersion {0};
+    glm::mat4 mRingCamera {0.0f};
+
+    static constexpr std::chrono::milliseconds mCameraMoveInterval {30};
+    static constexpr float mMaxZoom {256.0f};
 };
 
 }
@@ -0,0 +1,83 @@
+#include "Client.hpp"
+#include <sys/socket.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+namespace app::server {
+
+//region Constructor & Destructor
+
+Client::Client(const std::string& host, unsigned short port)
+    : mSocket{socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)}
+    , mReceiveBuffer(maxDatagramSize)
+{
+    if (mSocket.get() < 0) {
+        throw std::system_error{errno, std::generic_category(), "Failed to create client socket"};
+    }
+
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1) {
+        throw std::runtime_error{"Invalid server address"};
+    }
+    if (connect(mSocket.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        throw std::system_error{errno, std::generic_category(), "Failed to connect client socket"};
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+void Client::join() {
+    send({ClientMessageType::Join, 0, 0});
+}
+
+void Client::input(engine::Direction direction, bool boost) {
+    send({ClientMessageType::Input, static_cast<std::uint8_t>(direction), boost});
+}
+
+void Client::leave() {
+    send({ClientMessageType::Leave, 0, 0});
+}
+
+bool Client::receive() {
+    while (true) {
+        const auto received {recv(mSocket.get(), mReceiveBuffer.data(), mReceiveBuffer.size(), 0)};
+        if (received < 0) {
+            return false;
+        }
+        if (received < static_cast<ssize_t>(sizeof(StateHeader))) {
+            continue;
+        }
+
+        StateHeader header {};
+        std::memcpy(&header, mReceiveBuffer.data(), sizeof(header));
+        if (header.type != ServerMessageType::State) {
+            continue;
+        }
+
+        const std::span<const std::byte> snapshot {mReceiveBuffer.data() + sizeof(header), received - sizeof(header)};
+        if (mState.decode(snapshot)) {
+            mDeadline = std::chrono::steady_clock::time_point{std::chrono::nanoseconds{header.deadlineNs}};
+            return true;
+        }
+    }
+}
+
+//endregion
+
+//region Private Methods
+
+void Client::send(const ClientMessage& message) {
+    ::send(mSocket.get(), &message, sizeof(message), MSG_DONTWAIT);
+}
+
+//endregion
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <server/FileDescriptor.hpp>
+#include <server/Protocol.hpp>
+#include <server/Snapshot.hpp>
+#include <engine/Direction.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace app::server {
+
+/**
+ * Non-blocking UDP client, used by the load generator over loopback.
+ */
+class Client {
+public:
+    explicit Client(const std::string& host, unsigned short port);
+
+    Client(Client &&other) noexcept = default;
+    Client & operator=(Client &&other) noexcept = default;
+    ~Client() noexcept = default;
+
+    void join();
+    void input(engine::Direction direction, bool boost);
+    void leave();
+
+    /// Reads pending datagrams until one updates the state, false when there is nothing (usable) to read
+    bool receive();
+
+    inline const SnapshotDecoder& state() const {
+        return mState;
+    }
+    /// When the server scheduled the last received step
+    inline std::chrono::steady_clock::time_point deadline() const {
+        return mDeadline;
+    }
+
+    inline int fd() const {
+        return mSocket.get();
+    }
+
+private:
+    void send(const ClientMessage& message);
+
+private:
+    FileDescriptor mSocket;
+    std::vector<std::byte> mReceiveBuffer;
+    SnapshotDecoder mState;
+    std::chrono::steady_clock::time_point mDeadline;
+};
+
+}
@@ -0,0 +1,272 @@
+#include "EventLoop.hpp"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/timerfd.h>
+#include <sys/uio.h>
+#include <arpa/inet.h>
+#include <array>
+#include <cerrno>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+namespace app::server {
+
+namespace {
+
+constexpr std::uint64_t socketTag {0};
+constexpr std::uint64_t wakeupTag {1};
+constexpr std::uint64_t timerTag {2};
+
+std::system_error systemError(const char* what) {
+    return std::system_error{errno, std::generic_category(), what};
+}
+
+}
+
+//region Constructor & Destructor
+
+EventLoop::EventLoop(const Settings& settings)
+    : mSettings{settings}
+    , mEpoll{epoll_create1(EPOLL_CLOEXEC)}
+    , mSocket{socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0)}
+    , mWakeup{eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)}
+    , mTimer{timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)}
+    , mSeed{std::random_device{}()}
+{
+    if (mEpoll.get() < 0 || mSocket.get() < 0 || mWakeup.get() < 0 || mTimer.get() < 0) {
+        throw systemError("Failed to create event loop descriptors");
+    }
+
+    const int enable {1};
+    if (setsockopt(mSocket.get(), SOL_SOCKET, SO_REUSEPORT, &enable, sizeof(enable)) != 0) {
+        throw systemError("Failed to set SO_REUSEPORT");
+    }
+
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(mSettings.port);
+    if (bind(mSocket.get(), reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        throw systemError("Failed to bind server socket");
+    }
+
+    for (const auto& [fd, tag] : {
+        std::pair{mSocket.get(), socketTag}, std::pair{mWakeup.get(), wakeupTag}, std::pair{mTimer.get(), timerTag}
+    }) {
+        epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.u64 = tag;
+        if (epoll_ctl(mEpoll.get(), EPOLL_CTL_ADD, fd, &event) != 0) {
+            throw systemError("Failed to register descriptor in epoll");
+        }
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+void EventLoop::run() {
+    std::array<epoll_event, 256> events {};
+
+    while (true) {
+        const int count {epoll_wait(mEpoll.get(), events.data(), events.size(), -1)};
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw systemError("epoll_wait failed");
+        }
+
+        for (int i = 0; i < count; ++i) {
+            switch (events[i].data.u64) {
+                case socketTag:
+                    receive();
+                    break;
+                case timerTag:
+                    expireTimers();
+                    break;
+                case wakeupTag:
+                    return;
+            }
+        }
+
+        armTimer();
+    }
+}
+
+void EventLoop::stop() {
+    const std::uint64_t one {1};
+    [[maybe_unused]] const auto written {write(mWakeup.get(), &one, sizeof(one))};
+}
+
+//endregion
+
+//region Private Methods
+
+void EventLoop::receive() {
+    while (true) {
+        ClientMessage message {};
+        sockaddr_in address {};
+        socklen_t addressLength {sizeof(address)};
+
+        const auto received {recvfrom(
+            mSocket.get(), &message, sizeof(message), 0, reinterpret_cast<sockaddr*>(&address), &addressLength
+        )};
+        if (received < 0) {
+            return; // EAGAIN, drained
+        }
+        if (received != sizeof(message)) {
+            continue;
+        }
+
+        handleMessage(address, message);
+    }
+}
+
+void EventLoop::handleMessage(const sockaddr_in& address, const ClientMessage& message) {
+    const auto key {addressKey(address)};
+
+    switch (message.type) {
+        case ClientMessageType::Join:
+            join(address);
+            break;
+        case ClientMessageType::Leave:
+            leave(key);
+            break;
+        case ClientMessageType::Input: {
+            const auto it {mSessions.find(key)};
+            if (it == mSessions.end() || message.direction > static_cast<std::uint8_t>(engine::Direction::Right)) {
+                break;
+            }
+            auto& session {*it->second};
+
+            session.game.setNextDirection(static_cast<engine::Direction>(message.direction));
+
+            if (const bool boost {message.boost != 0}; boost != session.boost) {
+                session.boost = boost;
+                session.deadline = std::max(
+                    std::chrono::steady_clock::now(),
+                    session.lastMoveTime + moveInterval(session)
+                );
+                mTimerWheel.reschedule(session.timer, session.deadline);
+            }
+            break;
+        }
+    }
+}
+
+void EventLoop::join(const sockaddr_in& address) {
+    const auto key {addressKey(address)};
+    leave(key);
+
+    auto session {std::make_unique<Session>(Session{
+        address,
+        engine::Game{mSettings.boardSize, mSeed++},
+        SnapshotEncoder{mSettings.keyframeInterval},
+    })};
+
+    session->lastMoveTime = std::chrono::steady_clock::now();
+    session->deadline = session->lastMoveTime + moveInterval(*session);
+    session->timer = mTimerWheel.add(session->deadline, reinterpret_cast<std::uint64_t>(session.get()));
+    sendState(*session, SessionStatus::Running);
+
+    mSessions.emplace(key, std::move(session));
+    mSessionsCount.store(mSessions.size(), std::memory_order_relaxed);
+}
+
+void EventLoop::leave(std::uint64_t key) {
+    if (const auto it {mSessions.find(key)}; it != mSessions.end()) {
+        mTimerWheel.remove(it->second->timer);
+        mSessions.erase(it);
+        mSessionsCount.store(mSessions.size(), std::memory_order_relaxed);
+    }
+}
+
+void EventLoop::expireTimers() {
+    std::uint64_t expirations {0};
+    [[maybe_unused]] const auto read {::read(mTimer.get(), &expirations, sizeof(expirations))};
+    mArmedDeadline.reset();
+
+    mTimerWheel.expire(std::chrono::steady_clock::now(), [this](auto, std::uint64_t data){
+        tick(*reinterpret_cast<Session*>(data));
+    });
+}
+
+void EventLoop::armTimer() {
+    const auto deadline {mTimerWheel.nextDeadline()};
+    if (deadline == mArmedDeadline) {
+        return;
+    }
+    mArmedDeadline = deadline;
+
+    // zero disarms
+    itimerspec spec {};
+    if (deadline.has_value()) {
+        const auto sinceEpoch {std::max(deadline->time_since_epoch(), std::chrono::steady_clock::duration{1})};
+
+        spec.it_value.tv_sec = std::chrono::duration_cast<std::chrono::seconds>(sinceEpoch).count();
+        spec.it_value.tv_nsec = (sinceEpoch % std::chrono::seconds{1}) / std::chrono::nanoseconds{1};
+    }
+
+    if (timerfd_settime(mTimer.get(), TFD_TIMER_ABSTIME, &spec, nullptr) != 0) {
+        throw systemError("Failed to arm timer");
+    }
+}
+
+void EventLoop::tick(Session& session) {
+    session.lastMoveTime = session.deadline;
+    ++session.step;
+
+    auto status {SessionStatus::Running};
+    switch (session.game.move()) {
+        case engine::GameState::Lost: status = SessionStatus::Bump; break;
+        case engine::GameState::Won: status = SessionStatus::Win; break;
+        default: break;
+    }
+
+    sendState(session, status);
+
+    if (status != SessionStatus::Running) {
+        return leave(addressKey(session.address));
+    }
+
+    session.deadline += moveInterval(session);
+    mTimerWheel.reschedule(session.timer, session.deadline);
+}
+
+void EventLoop::sendState(Session& session, SessionStatus status) {
+    session.encoder.encode(session.game, status, session.step, mSnapshotBuffer);
+
+    StateHeader header {
+        ServerMessageType::State,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(session.deadline.time_since_epoch()).count(),
+    };
+
+    std::array<iovec, 2> parts {{
+        {&header, sizeof(header)},
+        {mSnapshotBuffer.data(), mSnapshotBuffer.size()},
+    }};
+
+    msghdr message {};
+    message.msg_name = &session.address;
+    message.msg_namelen = sizeof(session.address);
+    message.msg_iov = parts.data();
+    message.msg_iovlen = parts.size();
+
+    sendmsg(mSocket.get(), &message, MSG_DONTWAIT);
+}
+
+std::chrono::milliseconds EventLoop::moveInterval(const Session& session) const {
+    return mSettings.moveInterval / (session.boost ? 3 : 1);
+}
+
+std::uint64_t EventLoop::addressKey(const sockaddr_in& address) {
+    return (static_cast<std::uint64_t>(address.sin_addr.s_addr) << 16) | address.sin_port;
+}
+
+//endregion
+
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <server/FileDescriptor.hpp>
+#include <server/Protocol.hpp>
+#include <server/Snapshot.hpp>
+#include <engine/Game.hpp>
+#include <engine/TimerWheel.hpp>
+#include <netinet/in.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace app::server {
+
+struct Settings {
+    unsigned short port {defaultPort};
+    unsigned int threads {0}; // 0 - one per core
+    unsigned int boardSize {13};
+    std::chrono::milliseconds moveInterval {300};
+    unsigned int keyframeInterval {64};
+};
+
+/**
+ * One thread worth of sessions. Every loop binds its own UDP socket to the same port with `SO_REUSEPORT`,
+ * so the kernel keeps each client on the same loop and sessions never cross threads.
+ * Session moves are kept in a timer wheel, a single timerfd is armed for the earliest of them.
+ */
+class EventLoop {
+public:
+    explicit EventLoop(const Settings& settings);
+
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+    ~EventLoop() noexcept = default;
+
+    void run();
+    void stop();
+
+    /// Safe from any thread, the sessions themselves belong to the loop thread
+    inline size_t sessionsCount() const {
+        return mSessionsCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Session {
+        sockaddr_in address;
+        engine::Game game;
+        SnapshotEncoder encoder;
+        engine::TimerWheel::TimerId timer {};
+        bool boost {false};
+        std::uint32_t step {0};
+        std::chrono::steady_clock::time_point lastMoveTime {};
+        std::chrono::steady_clock::time_point deadline {};
+    };
+
+private:
+    void receive();
+    void handleMessage(const sockaddr_in& address, const ClientMessage& message);
+    void join(const sockaddr_in& address);
+    void leave(std::uint64_t key);
+    void expireTimers();
+    void armTimer();
+    void tick(Session& session);
+    void sendState(Session& session, SessionStatus status);
+    std::chrono::milliseconds moveInterval(const Session& session) const;
+
+    static std::uint64_t addressKey(const sockaddr_in& address);
+
+private:
+    Settings mSettings;
+    FileDescriptor mEpoll;
+    FileDescriptor mSocket;
+    FileDescriptor mWakeup;
+    FileDescriptor mTimer;
+    engine::TimerWheel mTimerWheel;
+    std::optional<engine::TimerWheel::Clock::time_point> mArmedDeadline;
+    std::unordered_map<std::uint64_t, std::unique_ptr<Session>> mSessions;
+    std::atomic<size_t> mSessionsCount {0};
+    std::vector<std::byte> mSnapshotBuffer;
+    unsigned int mSeed {0};
+};
+
+}
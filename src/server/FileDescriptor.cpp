@@ -0,0 +1,14 @@
+#include "FileDescriptor.hpp"
+#include <sys/resource.h>
+
+namespace app::server {
+
+void raiseOpenFilesLimit() {
+    rlimit limit {};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+}
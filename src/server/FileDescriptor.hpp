@@ -0,0 +1,37 @@
+#pragma once
+
+#include <unistd.h>
+#include <utility>
+
+namespace app::server {
+
+class FileDescriptor {
+public:
+    FileDescriptor() = default;
+    explicit FileDescriptor(int fd): mFd{fd} {}
+
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+    FileDescriptor(FileDescriptor &&other) noexcept : mFd{std::exchange(other.mFd, -1)} {}
+    FileDescriptor& operator=(FileDescriptor &&other) noexcept {
+        std::swap(mFd, other.mFd);
+        return *this;
+    }
+    ~FileDescriptor() noexcept {
+        if (mFd >= 0) {
+            ::close(mFd);
+        }
+    }
+
+    inline int get() const {
+        return mFd;
+    }
+
+private:
+    int mFd {-1};
+};
+
+/// Sessions and load generator clients use a descriptor each, the default soft limit of 1024 is not enough
+void raiseOpenFilesLimit();
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Datagrams are exchanged in host byte order, the server is meant to be reached over loopback or a homogeneous LAN.
+
+namespace app::server {
+
+constexpr unsigned short defaultPort {7013};
+constexpr size_t maxDatagramSize {65507};
+
+enum class ClientMessageType : std::uint8_t {Join = 1, Input, Leave};
+enum class ServerMessageType : std::uint8_t {State = 1};
+enum class SessionStatus : std::uint8_t {Running, Bump, Win};
+
+#pragma pack(push, 1)
+
+struct ClientMessage {
+    ClientMessageType type;
+    std::uint8_t direction;
+    std::uint8_t boost;
+};
+
+// followed by a snapshot, see `server/Snapshot.hpp`
+struct StateHeader {
+    ServerMessageType type;
+    std::int64_t deadlineNs; // steady clock time the step was scheduled for
+};
+
+#pragma pack(pop)
+
+}
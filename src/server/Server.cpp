@@ -0,0 +1,72 @@
+#include "Server.hpp"
+#include <pthread.h>
+#include <sched.h>
+#include <iostream>
+#include <stdexcept>
+
+namespace app::server {
+
+//region Constructor & Destructor
+
+Server::Server(const Settings& settings)
+    : mSettings{settings}
+{
+    if (mSettings.threads == 0) {
+        mSettings.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    if (sizeof(StateHeader) + SnapshotEncoder::maxKeyframeSize(mSettings.boardSize) > maxDatagramSize) {
+        throw std::runtime_error{"Board is too large for a state datagram"};
+    }
+
+    raiseOpenFilesLimit();
+
+    for (unsigned int i = 0; i < mSettings.threads; ++i) {
+        mLoops.push_back(std::make_unique<EventLoop>(mSettings));
+    }
+}
+
+Server::~Server() noexcept {
+    stop();
+}
+
+//endregion
+
+//region Public Methods
+
+void Server::start() {
+    for (size_t i = 0; i < mLoops.size(); ++i) {
+        mThreads.emplace_back([loop{mLoops[i].get()}]{
+            try {
+                loop->run();
+            } catch (const std::exception& e) {
+                std::cerr << "Event loop stopped: " << e.what() << std::endl;
+            }
+        });
+
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(i % CPU_SETSIZE, &cpus);
+        pthread_setaffinity_np(mThreads.back().native_handle(), sizeof(cpus), &cpus);
+    }
+}
+
+void Server::stop() {
+    for (const auto& loop : mLoops) {
+        loop->stop();
+    }
+    mThreads.clear(); // joins
+}
+
+size_t Server::sessionsCount() const {
+    // a sum of counts each loop publishes, sessions joining meanwhile may be missed
+    size_t count {0};
+    for (const auto& loop : mLoops) {
+        count += loop->sessionsCount();
+    }
+    return count;
+}
+
+//endregion
+
+}
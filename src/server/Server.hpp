@@ -0,0 +1,29 @@
+#pragma once
+
+#include <server/EventLoop.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace app::server {
+
+class Server {
+public:
+    explicit Server(const Settings& settings);
+
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+    ~Server() noexcept;
+
+    void start();
+    void stop();
+
+    size_t sessionsCount() const;
+
+private:
+    Settings mSettings;
+    std::vector<std::unique_ptr<EventLoop>> mLoops;
+    std::vector<std::jthread> mThreads;
+};
+
+}
@@ -0,0 +1,228 @@
+#include "Snapshot.hpp"
+#include <util/BitStream.hpp>
+#include <algorithm>
+#include <bit>
+
+namespace app::server {
+
+namespace {
+
+constexpr unsigned int statusBits {2};
+constexpr unsigned int directionBits {2};
+constexpr unsigned int deltaStepBits {4};
+
+unsigned int cellBits(unsigned int boardSize) {
+    return std::max(1u, static_cast<unsigned int>(std::bit_width(boardSize - 1)));
+}
+
+void writeCell(util::BitWriter& writer, const glm::uvec2& cell, unsigned int bits) {
+    writer.write(cell.x, bits);
+    writer.write(cell.y, bits);
+}
+
+glm::uvec2 readCell(util::BitReader& reader, unsigned int bits) {
+    const auto x {reader.read(bits)};
+    return {x, reader.read(bits)};
+}
+
+}
+
+//region SnapshotEncoder
+
+SnapshotEncoder::SnapshotEncoder(unsigned int keyframeInterval)
+    : mKeyframeInterval{std::max(1u, keyframeInterval)}
+{}
+
+void SnapshotEncoder::encode(
+    const engine::Game& game, SessionStatus status, std::uint32_t step, std::vector<std::byte>& output
+) {
+    const auto& body {game.body()};
+    const auto [head, direction] {body.front()};
+
+    const bool headPushed {head != mHead};
+    const auto tailPopped {static_cast<long long>(mLength) + headPushed - static_cast<long long>(body.size())};
+
+    if (
+        !mHasState
+        || step != mStep + 1
+        || step - mKeyframeStep >= mKeyframeInterval
+        || (headPushed && head != engine::moveCell(mHead, direction, game.boardSize()))
+        || tailPopped < 0 || tailPopped > 1
+    ) {
+        return encodeKeyframe(game, status, step, output);
+    }
+
+    const bool treatChanged {game.treat() != mTreat};
+
+    util::BitWriter writer {output};
+    writer.write(0, 1);
+    writer.write(static_cast<std::uint32_t>(status), statusBits);
+    writer.write(step, deltaStepBits);
+    writer.write(headPushed, 1);
+    writer.write(static_cast<std::uint32_t>(direction), directionBits);
+    writer.write(tailPopped, 1);
+    writer.write(game.skipTailMove(), 1);
+    writer.write(treatChanged, 1);
+    if (treatChanged) {
+        writeCell(writer, game.treat(), cellBits(game.boardSize()));
+    }
+    writer.flush();
+
+    remember(game, step);
+}
+
+void SnapshotEncoder::encodeKeyframe(
+    const engine::Game& game, SessionStatus status, std::uint32_t step, std::vector<std::byte>& output
+) {
+    const auto& body {game.body()};
+    const auto bits {cellBits(game.boardSize())};
+
+    output.reserve(maxKeyframeSize(game.boardSize()));
+
+    util::BitWriter writer {output};
+    writer.write(1, 1);
+    writer.write(static_cast<std::uint32_t>(status), statusBits);
+    writer.write(step, 32);
+    writer.write(game.boardSize(), 16);
+    writer.write(body.size(), 32);
+    writeCell(writer, game.treat(), bits);
+    writer.write(game.skipTailMove(), 1);
+    writeCell(writer, body.front().first, bits);
+    for (const auto& [cell, direction] : body) {
+        writer.write(static_cast<std::uint32_t>(direction), directionBits);
+    }
+    writer.flush();
+
+    mKeyframeStep = step;
+    remember(game, step);
+}
+
+size_t SnapshotEncoder::maxKeyframeSize(unsigned int boardSize) {
+    const size_t area {static_cast<size_t>(boardSize) * boardSize};
+    const size_t bits {1 + statusBits + 32 + 16 + 32 + 4 * cellBits(boardSize) + 1 + area * directionBits};
+
+    return (bits + 7) / 8;
+}
+
+void SnapshotEncoder::remember(const engine::Game& game, std::uint32_t step) {
+    mHasState = true;
+    mStep = step;
+    mHead = game.body().front().first;
+    mTreat = game.treat();
+    mLength = game.body().size();
+}
+
+//endregion
+
+//region SnapshotDecoder
+
+bool SnapshotDecoder::decode(std::span<const std::byte> data) {
+    if (data.empty()) {
+        return false;
+    }
+
+    return (std::to_integer<unsigned int>(data[0]) & 1) ? decodeKeyframe(data) : decodeDelta(data);
+}
+
+bool SnapshotDecoder::decodeKeyframe(std::span<const std::byte> data) {
+    util::BitReader reader {data};
+    reader.read(1);
+
+    const auto status {reader.read(statusBits)};
+    const auto step {reader.read(32)};
+    const auto boardSize {reader.read(16)};
+    const auto length {reader.read(32)};
+
+    if (
+        reader.overflow() || boardSize < 3 || length == 0
+        || length > static_cast<size_t>(boardSize) * boardSize
+        || data.size() * 8 < static_cast<size_t>(length) * directionBits
+    ) {
+        mSynced = false;
+        return false;
+    }
+
+    const auto bits {cellBits(boardSize)};
+    const auto treat {readCell(reader, bits)};
+    const bool skipTailMove {reader.read(1) != 0};
+    auto cell {readCell(reader, bits)};
+
+    if (treat.x >= boardSize || treat.y >= boardSize || cell.x >= boardSize || cell.y >= boardSize) {
+        mSynced = false;
+        return false;
+    }
+
+    mBody.reset(boardSize);
+
+    for (std::uint32_t i = 0; i < length; ++i) {
+        const auto direction {static_cast<engine::Direction>(reader.read(directionBits))};
+        mBody.pushBack(cell, direction);
+
+        // the segment was entered moving in its direction, so the next one is a step back
+        cell = engine::moveCell(cell, engine::opposite(direction), boardSize);
+    }
+
+    if (reader.overflow() || status > static_cast<std::uint32_t>(SessionStatus::Win)) {
+        mSynced = false;
+        return false;
+    }
+
+    mSynced = true;
+    mStatus = static_cast<SessionStatus>(status);
+    mStep = step;
+    mBoardSize = boardSize;
+    mTreat = treat;
+    mSkipTailMove = skipTailMove;
+
+    return true;
+}
+
+bool SnapshotDecoder::decodeDelta(std::span<const std::byte> data) {
+    if (!mSynced) {
+        return false;
+    }
+
+    util::BitReader reader {data};
+    reader.read(1);
+
+    const auto status {reader.read(statusBits)};
+    const auto step {reader.read(deltaStepBits)};
+    const bool headPushed {reader.read(1) != 0};
+    const auto direction {static_cast<engine::Direction>(reader.read(directionBits))};
+    const bool tailPopped {reader.read(1) != 0};
+    const bool skipTailMove {reader.read(1) != 0};
+    const bool treatChanged {reader.read(1) != 0};
+    const auto treat {treatChanged ? readCell(reader, cellBits(mBoardSize)) : mTreat};
+
+    if (
+        reader.overflow()
+        || status > static_cast<std::uint32_t>(SessionStatus::Win)
+        || step != ((mStep + 1) & util::BitWriter::mask(deltaStepBits))
+        || (tailPopped && mBody.size() < 2)
+        || (headPushed && !tailPopped && mBody.size() >= mBody.capacity())
+        || treat.x >= mBoardSize || treat.y >= mBoardSize
+    ) {
+        mSynced = false; // lost datagram, wait for the next keyframe
+        return false;
+    }
+
+    if (headPushed) {
+        if (tailPopped) {
+            mBody.popBack();
+        }
+        mBody.pushFront(engine::moveCell(mBody.front().first, direction, mBoardSize), direction);
+    } else if (tailPopped) {
+        mBody.popBack();
+    }
+
+    mStatus = static_cast<SessionStatus>(status);
+    ++mStep;
+    mTreat = treat;
+    mSkipTailMove = skipTailMove;
+
+    return true;
+}
+
+//endregion
+
+}
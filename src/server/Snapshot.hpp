@@ -0,0 +1,89 @@
+#pragma once
+
+#include <server/Protocol.hpp>
+#include <engine/Game.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/*
+ * Bit-packed game state stream.
+ *
+ * Keyframe: 1 flag, 2 status, 32 step, 16 board size, 32 length, treat, 1 skip tail move, head,
+ *           then 2 bits of direction per segment (each segment follows from the previous one).
+ * Delta:    1 flag, 2 status, 4 low step bits, 1 head pushed, 2 head direction, 1 tail popped, 1 skip tail move,
+ *           1 treat changed [+ treat].
+ * Cells take `ceil(log2(board size))` bits per coordinate.
+ */
+
+namespace app::server {
+
+class SnapshotEncoder {
+public:
+    explicit SnapshotEncoder(unsigned int keyframeInterval = 64);
+
+    /// Writes a delta against the previously encoded state, or a keyframe when due or when the change is not a step
+    void encode(const engine::Game& game, SessionStatus status, std::uint32_t step, std::vector<std::byte>& output);
+    void encodeKeyframe(const engine::Game& game, SessionStatus status, std::uint32_t step, std::vector<std::byte>& output);
+
+    static size_t maxKeyframeSize(unsigned int boardSize);
+
+private:
+    /// What the next delta is taken against, the status goes out whole in every one
+    void remember(const engine::Game& game, std::uint32_t step);
+
+private:
+    unsigned int mKeyframeInterval;
+    bool mHasState {false};
+    std::uint32_t mStep {0};
+    std::uint32_t mKeyframeStep {0};
+    glm::uvec2 mHead {};
+    glm::uvec2 mTreat {};
+    size_t mLength {0};
+};
+
+class SnapshotDecoder {
+public:
+    SnapshotDecoder() = default;
+
+    /// False if the data is malformed or a delta arrived without the state it is based on
+    bool decode(std::span<const std::byte> data);
+
+    inline bool synced() const {
+        return mSynced;
+    }
+    inline SessionStatus status() const {
+        return mStatus;
+    }
+    inline std::uint32_t step() const {
+        return mStep;
+    }
+    inline unsigned int boardSize() const {
+        return mBoardSize;
+    }
+    inline const engine::Body& body() const {
+        return mBody;
+    }
+    inline const glm::uvec2& treat() const {
+        return mTreat;
+    }
+    inline bool skipTailMove() const {
+        return mSkipTailMove;
+    }
+
+private:
+    bool decodeKeyframe(std::span<const std::byte> data);
+    bool decodeDelta(std::span<const std::byte> data);
+
+private:
+    bool mSynced {false};
+    SessionStatus mStatus {SessionStatus::Running};
+    std::uint32_t mStep {0};
+    unsigned int mBoardSize {0};
+    engine::Body mBody;
+    glm::uvec2 mTreat {};
+    bool mSkipTailMove {false};
+};
+
+}
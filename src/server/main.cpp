@@ -0,0 +1,47 @@
+#include <server/Server.hpp>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    app::server::Settings settings {};
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option {argv[i]};
+        const auto value {std::stoul(argv[i + 1])};
+
+        if (option == "--port") {
+            settings.port = value;
+        } else if (option == "--threads") {
+            settings.threads = value;
+        } else if (option == "--board") {
+            settings.boardSize = value;
+        } else if (option == "--interval") {
+            settings.moveInterval = std::chrono::milliseconds{value};
+        } else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr); // inherited by the event loop threads
+
+    app::server::Server server {settings};
+    server.start();
+
+    std::cout << "Listening on UDP port " << settings.port << std::endl;
+
+    int signal {0};
+    sigwait(&signals, &signal);
+
+    std::cout << "Stopping" << std::endl;
+    server.stop();
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <engine/Autopilot.hpp>
+#include <engine/Game.hpp>
+#include <engine/StateRing.hpp>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <csignal>
+#include <ctime>
+#include <iostream>
+#include <random>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    // --name <shared memory name> --board <size> --interval <ms> --spin <degrees per move>
+    std::string name {"/snake"};
+    unsigned int boardSize {13};
+    std::chrono::milliseconds moveInterval {300};
+    float spin {0};
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        const std::string option {argv[i]};
+
+        if (option == "--name") {
+            name = argv[i + 1];
+        } else if (option == "--board") {
+            boardSize = std::stoul(argv[i + 1]);
+        } else if (option == "--interval") {
+            moveInterval = std::chrono::milliseconds{std::stoul(argv[i + 1])};
+        } else if (option == "--spin") {
+            spin = std::stof(argv[i + 1]);
+        } else {
+            std::cerr << "Unknown option " << option << std::endl;
+            return 1;
+        }
+    }
+
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    const auto ring {app::engine::StateRing::create(name, boardSize)};
+    app::engine::Game game {boardSize};
+    app::engine::Autopilot autopilot {boardSize};
+
+    // the camera of the game window, turned a little on every move with --spin
+    auto camera {glm::lookAt(glm::vec3(0.0f, -0.6f, 1.1f), glm::vec3(0.0f, -0.07f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f))};
+
+    std::cout << "Publishing a " << boardSize << "x" << boardSize << " autopilot game to " << name
+        << ", follow it with snake_game_opengl --follow " << name << std::endl;
+
+    // the wait for the next move is a wait for the signal that stops the simulation
+    for (;;) {
+        const auto movedAt {app::engine::StateRing::Clock::now()};
+
+        game.setNextDirection(autopilot.decide(game));
+        if (game.move() != app::engine::GameState::Running) {
+            game.reset(std::random_device{}());
+            autopilot.reset();
+        }
+        camera = glm::rotate(camera, glm::radians(spin), {0.0f, 0.0f, 1.0f});
+
+        ring->publish(game, camera, movedAt, moveInterval);
+
+        const auto left {movedAt + moveInterval - app::engine::StateRing::Clock::now()};
+        const auto nanoseconds {std::max<long long>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(left).count())};
+        const timespec timeout {static_cast<time_t>(nanoseconds / 1'000'000'000), static_cast<long>(nanoseconds % 1'000'000'000)};
+        if (sigtimedwait(&signals, nullptr, &timeout) > 0) {
+            break;
+        }
+    }
+
+    std::cout << "Stopping after " << ring->published() << " states" << std::endl;
+
+    return 0;
+}
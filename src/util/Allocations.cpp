@@ -0,0 +1,131 @@
+#include "Allocations.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace app::util::allocations {
+
+namespace {
+
+std::atomic<size_t> totalCount {0};
+std::atomic<size_t> steadyStateCount {0};
+thread_local bool inSteadyState {false};
+
+inline void count() noexcept {
+    totalCount.fetch_add(1, std::memory_order_relaxed);
+    if (inSteadyState) {
+        steadyStateCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+inline void* allocate(size_t size) noexcept {
+    count();
+    return std::malloc(size != 0 ? size : 1);
+}
+
+// the address malloc returned is kept right before the aligned block, std::aligned_alloc is not on every platform
+inline void* allocateAligned(size_t size, std::align_val_t alignment) noexcept {
+    count();
+
+    const auto align {static_cast<size_t>(alignment)};
+    void* raw {std::malloc(size + align + sizeof(void*))};
+    if (raw == nullptr) {
+        return nullptr;
+    }
+
+    const auto address {(reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + align - 1) & ~(align - 1)};
+    reinterpret_cast<void**>(address)[-1] = raw;
+
+    return reinterpret_cast<void*>(address);
+}
+
+inline void freeAligned(void* pointer) noexcept {
+    if (pointer != nullptr) {
+        std::free(static_cast<void**>(pointer)[-1]);
+    }
+}
+
+}
+
+size_t total() {
+    return totalCount.load(std::memory_order_relaxed);
+}
+
+size_t steadyState() {
+    return steadyStateCount.load(std::memory_order_relaxed);
+}
+
+SteadyState::SteadyState() noexcept
+    : mOuter{!inSteadyState}
+{
+    inSteadyState = true;
+}
+
+SteadyState::~SteadyState() noexcept {
+    if (mOuter) {
+        inSteadyState = false;
+    }
+}
+
+}
+
+using app::util::allocations::allocate;
+using app::util::allocations::allocateAligned;
+using app::util::allocations::freeAligned;
+
+//region Replaced global allocation functions
+
+void* operator new(std::size_t size) {
+    if (void* pointer {allocate(size)}; pointer != nullptr) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* pointer {allocateAligned(size, alignment)}; pointer != nullptr) {
+        return pointer;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return ::operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+
+void operator delete(void* pointer, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { freeAligned(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { freeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { freeAligned(pointer); }
+
+//endregion
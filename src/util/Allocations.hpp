@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+namespace app::util::allocations {
+
+/*
+ * Counts heap allocations through the replaced global `operator new`, linked into the game only.
+ * Code that should not allocate, such as a tick or a frame, runs inside a `SteadyState` scope,
+ * and any allocation there is counted separately.
+ */
+
+/// Every allocation since start, on every thread
+size_t total();
+/// Allocations made inside `SteadyState` scopes, on every thread
+size_t steadyState();
+
+class SteadyState {
+public:
+    SteadyState() noexcept;
+
+    SteadyState(const SteadyState&) = delete;
+    SteadyState & operator=(const SteadyState&) = delete;
+
+    ~SteadyState() noexcept;
+
+private:
+    bool mOuter;
+};
+
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace app::util {
+
+/// Appends little-endian bit fields of up to 32 bits
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<std::byte>& buffer)
+        : mBuffer{buffer}
+    {
+        mBuffer.clear();
+    }
+
+    inline void write(std::uint32_t value, unsigned int bits) {
+        mAccumulator |= static_cast<std::uint64_t>(value & mask(bits)) << mBits;
+        mBits += bits;
+
+        while (mBits >= 8) {
+            mBuffer.push_back(static_cast<std::byte>(mAccumulator));
+            mAccumulator >>= 8;
+            mBits -= 8;
+        }
+    }
+
+    inline void flush() {
+        if (mBits > 0) {
+            mBuffer.push_back(static_cast<std::byte>(mAccumulator));
+            mAccumulator = 0;
+            mBits = 0;
+        }
+    }
+
+    static constexpr std::uint32_t mask(unsigned int bits) {
+        return bits >= 32 ? ~std::uint32_t{0} : (std::uint32_t{1} << bits) - 1;
+    }
+
+private:
+    std::vector<std::byte>& mBuffer;
+    std::uint64_t mAccumulator {0};
+    unsigned int mBits {0};
+};
+
+class BitReader {
+public:
+    explicit BitReader(std::span<const std::byte> data)
+        : mData{data}
+    {}
+
+    inline std::uint32_t read(unsigned int bits) {
+        while (mBits < bits) {
+            if (mPosition == mData.size()) {
+                mOverflow = true;
+                return 0;
+            }
+            mAccumulator |= static_cast<std::uint64_t>(mData[mPosition++]) << mBits;
+            mBits += 8;
+        }
+
+        const auto value {static_cast<std::uint32_t>(mAccumulator & BitWriter::mask(bits))};
+        mAccumulator >>= bits;
+        mBits -= bits;
+
+        return value;
+    }
+
+    inline bool overflow() const {
+        return mOverflow;
+    }
+
+private:
+    std::span<const std::byte> mData;
+    size_t mPosition {0};
+    std::uint64_t mAccumulator {0};
+    unsigned int mBits {0};
+    bool mOverflow {false};
+};
+
+}
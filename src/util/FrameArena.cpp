@@ -0,0 +1,52 @@
+#include "FrameArena.hpp"
+#include <stdexcept>
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+FrameArena::FrameArena(size_t capacity)
+    : mBuffer{std::make_unique_for_overwrite<std::byte[]>(capacity)}
+    , mCapacity{capacity}
+{}
+
+//endregion
+
+//region Public Methods
+
+void FrameArena::reset() {
+    if (!mOverflow.empty()) {
+        // room for the whole last frame, with slack for alignment
+        mCapacity = (mCapacity + mOverflowBytes) * 2;
+        mBuffer = std::make_unique_for_overwrite<std::byte[]>(mCapacity);
+        mOverflow.clear();
+        mOverflowBytes = 0;
+    }
+
+    mUsed = 0;
+}
+
+//endregion
+
+//region Private Methods
+
+void* FrameArena::allocateBytes(size_t bytes, size_t alignment) {
+    if (alignment > alignof(std::max_align_t)) {
+        throw std::runtime_error{"Arena alignment is too large"};
+    }
+
+    const auto offset {(mUsed + alignment - 1) & ~(alignment - 1)};
+    if (offset + bytes <= mCapacity) {
+        mUsed = offset + bytes;
+        return mBuffer.get() + offset;
+    }
+
+    mOverflow.push_back(std::make_unique_for_overwrite<std::byte[]>(bytes));
+    mOverflowBytes += bytes;
+
+    return mOverflow.back().get();
+}
+
+//endregion
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * Bump allocator for data that lives one frame, e.g. instance matrices on their way to a buffer object.
+ * `reset()` frees everything at once. A frame that does not fit is served from extra blocks,
+ * the next `reset()` replaces them with one buffer large enough, so only warm-up frames allocate.
+ */
+class FrameArena {
+public:
+    explicit FrameArena(size_t capacity = 256 * 1024);
+
+    FrameArena(FrameArena &&other) noexcept = default;
+    FrameArena & operator=(FrameArena &&other) noexcept = default;
+    ~FrameArena() noexcept = default;
+
+    /// Default-initialized storage for `count` objects, valid until `reset()`
+    template<typename T>
+    std::span<T> allocate(size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+
+        auto* storage {static_cast<T*>(allocateBytes(sizeof(T) * count, alignof(T)))};
+        std::uninitialized_default_construct_n(storage, count);
+
+        return {storage, count};
+    }
+
+    /// One object constructed in place, valid until `reset()`
+    template<typename T, typename... Args>
+    T& create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "Arena objects are never destroyed");
+
+        return *new (allocateBytes(sizeof(T), alignof(T))) T{std::forward<Args>(args)...};
+    }
+
+    void reset();
+
+    inline size_t capacity() const {
+        return mCapacity;
+    }
+    /// Bytes handed out since `reset()`, including the extra blocks
+    inline size_t used() const {
+        return mUsed + mOverflowBytes;
+    }
+
+private:
+    void* allocateBytes(size_t bytes, size_t alignment);
+
+private:
+    std::unique_ptr<std::byte[]> mBuffer;
+    size_t mCapacity;
+    size_t mUsed {0};
+    std::vector<std::unique_ptr<std::byte[]>> mOverflow;
+    size_t mOverflowBytes {0};
+};
+
+}
@@ -0,0 +1,127 @@
+#include "FrameCapture.hpp"
+#include <util/Trace.hpp>
+#include <iomanip>
+
+namespace app::util {
+
+namespace {
+
+std::array<int, 4> viewport() {
+    std::array<int, 4> viewport {};
+    glGetIntegerv(GL_VIEWPORT, viewport.data());
+    return viewport;
+}
+
+}
+
+//region Constructor & Destructor
+
+FrameCapture::FrameCapture(const std::filesystem::path& directory, FrameEncoder::Format format)
+    : mWidth{static_cast<unsigned int>(viewport()[2])}
+    , mHeight{static_cast<unsigned int>(viewport()[3])}
+    , mEncoder{directory, format, mWidth, mHeight}
+{
+    for (auto& slot : mSlots) {
+        glGenBuffers(1, &slot.pbo);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(mEncoder.frameBytes()), nullptr, GL_STREAM_READ);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+FrameCapture::~FrameCapture() noexcept {
+    finish();
+
+    for (auto& slot : mSlots) {
+        glDeleteBuffers(1, &slot.pbo);
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+void FrameCapture::capture() {
+    TRACE_ZONE("FrameCapture::capture");
+    const auto begin {std::chrono::steady_clock::now()};
+
+    // earlier frames the GPU is done with
+    while (collect(false)) {}
+
+    if (mInFlight == ringSize) {
+        ++mDropped;
+    } else {
+        auto& slot {mSlots[(mFirst + mInFlight) % ringSize]};
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+        glReadPixels(0, 0, static_cast<GLsizei>(mWidth), static_cast<GLsizei>(mHeight), GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        ++mInFlight;
+    }
+
+    ++mFrames;
+    mCaptureTime += std::chrono::steady_clock::now() - begin;
+}
+
+void FrameCapture::finish() {
+    while (mInFlight > 0) {
+        if (!collect(true)) {
+            // the GPU never got there, the frame is lost
+            glDeleteSync(mSlots[mFirst].fence);
+            mSlots[mFirst].fence = nullptr;
+            mFirst = (mFirst + 1) % ringSize;
+            --mInFlight;
+            ++mDropped;
+        }
+    }
+
+    mEncoder.flush();
+}
+
+void FrameCapture::report(std::ostream& stream) const {
+    const auto perFrame {mFrames > 0 ? std::chrono::duration<double, std::milli>{mCaptureTime}.count() / mFrames : 0.0};
+
+    stream
+        << "capture " << mWidth << "x" << mHeight << ": " << mEncoder.written() << " of " << mFrames << " frames written, "
+        << mDropped + mEncoder.dropped() << " dropped, " << std::fixed << std::setprecision(3) << perFrame
+        << " ms per frame on the render thread" << std::endl;
+}
+
+//endregion
+
+//region Private Methods
+
+bool FrameCapture::collect(bool wait) {
+    if (mInFlight == 0) {
+        return false;
+    }
+
+    auto& slot {mSlots[mFirst]};
+    constexpr GLuint64 waitTimeout {1'000'000'000}; // ns
+    const auto status {glClientWaitSync(slot.fence, wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, wait ? waitTimeout : 0)};
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+        return false;
+    }
+
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+
+    const auto bytes {mEncoder.frameBytes()};
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+    if (const auto* pixels {static_cast<const std::byte*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(bytes), GL_MAP_READ_BIT))}) {
+        mEncoder.submit({pixels, bytes});
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    mFirst = (mFirst + 1) % ringSize;
+    --mInFlight;
+
+    return true;
+}
+
+//endregion
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <util/FrameEncoder.hpp>
+#include <glad/glad.h>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <ostream>
+
+namespace app::util {
+
+/**
+ * Reads rendered frames back without stalling the render thread. `capture()` starts an asynchronous
+ * `glReadPixels()` into the next of a ring of pixel buffer objects and fences it, a buffer is mapped
+ * only once its fence signaled, a frame or two later, and its pixels go to a `FrameEncoder`.
+ * A frame that finds the ring full is dropped, never waited for. Needs the GL context of the frames.
+ */
+class FrameCapture {
+public:
+    static constexpr size_t ringSize {3};
+
+    /// The whole viewport of the current context
+    FrameCapture(const std::filesystem::path& directory, FrameEncoder::Format format);
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture & operator=(const FrameCapture&) = delete;
+    /// Writes the frames still in flight
+    ~FrameCapture() noexcept;
+
+    /// After rendering a frame, before the buffer swap
+    void capture();
+    /// Waits for the frames in flight and for the encoder
+    void finish();
+
+    /// Frames written and dropped, and the time `capture()` took per frame
+    void report(std::ostream& stream) const;
+
+private:
+    struct Slot {
+        unsigned int pbo {0};
+        GLsync fence {nullptr};
+    };
+
+    /// Hands the oldest frame in flight to the encoder once its fence signaled, `wait` blocks for it
+    bool collect(bool wait);
+
+private:
+    unsigned int mWidth {0};
+    unsigned int mHeight {0};
+    std::array<Slot, ringSize> mSlots {};
+    size_t mFirst {0};
+    size_t mInFlight {0};
+
+    size_t mFrames {0};
+    size_t mDropped {0};
+    std::chrono::steady_clock::duration mCaptureTime {};
+
+    FrameEncoder mEncoder;
+};
+
+}
@@ -0,0 +1,238 @@
+#include "FrameEncoder.hpp"
+#include <util/Trace.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace app::util {
+
+namespace {
+
+constexpr std::array<std::uint32_t, 256> crcTable {[] {
+    std::array<std::uint32_t, 256> table {};
+    for (std::uint32_t n = 0; n < 256; ++n) {
+        auto c {n};
+        for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[n] = c;
+    }
+    return table;
+}()};
+
+void appendBigEndian(std::vector<std::byte>& out, std::uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<std::byte>(value >> shift));
+    }
+}
+
+/// Length, type, data and the CRC of type and data
+void appendChunk(std::vector<std::byte>& out, const char (&type)[5], std::span<const std::byte> data) {
+    appendBigEndian(out, static_cast<std::uint32_t>(data.size()));
+    const auto begin {out.size()};
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<std::byte>(type[i]));
+    }
+    out.insert(out.end(), data.begin(), data.end());
+
+    std::uint32_t crc {0xFFFFFFFFu};
+    for (auto i = begin; i < out.size(); ++i) {
+        crc = crcTable[(crc ^ static_cast<std::uint8_t>(out[i])) & 0xFF] ^ (crc >> 8);
+    }
+    appendBigEndian(out, crc ^ 0xFFFFFFFFu);
+}
+
+}
+
+//region Constructor & Destructor
+
+FrameEncoder::FrameEncoder(const std::filesystem::path& directory, Format format, unsigned int width, unsigned int height, size_t buffers)
+    : mDirectory{directory}
+    , mFormat{format}
+    , mWidth{width}
+    , mHeight{height}
+    , mBuffers(buffers, std::vector<std::byte>(frameBytes()))
+    , mQueue(buffers)
+{
+    if (width == 0 || height == 0 || buffers == 0) {
+        throw std::runtime_error{"Invalid capture size"};
+    }
+
+    std::filesystem::create_directories(mDirectory);
+    if (mFormat == Format::Raw) {
+        mRawStream.open(mDirectory / "frames.rgba", std::ios::binary | std::ios::trunc);
+        if (!mRawStream) {
+            throw std::runtime_error{"Failed to open " + (mDirectory / "frames.rgba").string()};
+        }
+    }
+
+    mFree.reserve(buffers);
+    for (size_t buffer = buffers; buffer > 0; --buffer) {
+        mFree.push_back(buffer - 1);
+    }
+
+    mThread = std::jthread{[this](std::stop_token stopToken) { work(stopToken); }};
+}
+
+FrameEncoder::~FrameEncoder() noexcept {
+    // the worker empties the queue before it sees the stop
+    mThread.request_stop();
+    mThread = {};
+}
+
+//endregion
+
+//region Public Methods
+
+bool FrameEncoder::submit(std::span<const std::byte> pixels) {
+    if (pixels.size() != frameBytes()) {
+        throw std::runtime_error{"Frame size does not match the capture"};
+    }
+
+    size_t buffer {0};
+    {
+        std::lock_guard lock {mMutex};
+        if (mFree.empty()) {
+            mDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        buffer = mFree.back();
+        mFree.pop_back();
+    }
+
+    // flipped while copying, files start with the top row
+    const size_t rowBytes {static_cast<size_t>(mWidth) * 4};
+    auto* target {mBuffers[buffer].data()};
+    for (size_t row = 0; row < mHeight; ++row) {
+        std::memcpy(target + (mHeight - 1 - row) * rowBytes, pixels.data() + row * rowBytes, rowBytes);
+    }
+
+    {
+        std::lock_guard lock {mMutex};
+        mQueue[(mQueueFront + mQueueSize) % mQueue.size()] = buffer;
+        ++mQueueSize;
+        ++mSubmitted;
+    }
+    mQueued.notify_one();
+
+    return true;
+}
+
+void FrameEncoder::flush() {
+    std::unique_lock lock {mMutex};
+    mCompletedCondition.wait(lock, [this] { return mCompleted == mSubmitted; });
+}
+
+std::vector<std::byte> FrameEncoder::encodePng(unsigned int width, unsigned int height, std::span<const std::byte> pixels) {
+    const size_t rowBytes {static_cast<size_t>(width) * 4};
+
+    // rows with filter type 0 in front, in stored deflate blocks of at most 65535 bytes
+    std::vector<std::byte> filtered {};
+    filtered.reserve((rowBytes + 1) * height);
+    for (size_t row = 0; row < height; ++row) {
+        filtered.push_back(std::byte{0});
+        filtered.insert(filtered.end(), pixels.begin() + row * rowBytes, pixels.begin() + (row + 1) * rowBytes);
+    }
+
+    std::vector<std::byte> zlib {std::byte{0x78}, std::byte{0x01}};
+    zlib.reserve(filtered.size() + filtered.size() / 65535 * 5 + 16);
+    for (size_t offset = 0; offset < filtered.size(); offset += 65535) {
+        const auto length {static_cast<std::uint16_t>(std::min<size_t>(65535, filtered.size() - offset))};
+        const bool last {offset + length >= filtered.size()};
+        zlib.insert(zlib.end(), {
+            static_cast<std::byte>(last),
+            static_cast<std::byte>(length), static_cast<std::byte>(length >> 8),
+            static_cast<std::byte>(~length), static_cast<std::byte>(~length >> 8),
+        });
+        zlib.insert(zlib.end(), filtered.begin() + offset, filtered.begin() + offset + length);
+    }
+
+    // the sums stay below 2^32 for 5552 bytes between the modulos
+    std::uint32_t a {1}, b {0};
+    for (size_t offset = 0; offset < filtered.size(); offset += 5552) {
+        const auto end {std::min(filtered.size(), offset + 5552)};
+        for (auto i = offset; i < end; ++i) {
+            a += static_cast<std::uint8_t>(filtered[i]);
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    appendBigEndian(zlib, (b << 16) | a);
+
+    std::vector<std::byte> png {
+        std::byte{0x89}, std::byte{'P'}, std::byte{'N'}, std::byte{'G'},
+        std::byte{'\r'}, std::byte{'\n'}, std::byte{0x1A}, std::byte{'\n'},
+    };
+    png.reserve(zlib.size() + 64);
+
+    // 8 bits per channel, RGBA, no interlacing
+    std::vector<std::byte> header {};
+    appendBigEndian(header, width);
+    appendBigEndian(header, height);
+    header.insert(header.end(), {std::byte{8}, std::byte{6}, std::byte{0}, std::byte{0}, std::byte{0}});
+
+    appendChunk(png, "IHDR", header);
+    appendChunk(png, "IDAT", zlib);
+    appendChunk(png, "IEND", {});
+
+    return png;
+}
+
+//endregion
+
+//region Private Methods
+
+void FrameEncoder::work(std::stop_token stopToken) {
+    TRACE_THREAD("encoder");
+
+    for (size_t frame = 0;; ++frame) {
+        size_t buffer {0};
+        {
+            std::unique_lock lock {mMutex};
+            if (!mQueued.wait(lock, stopToken, [this] { return mQueueSize > 0; })) {
+                return;
+            }
+            buffer = mQueue[mQueueFront];
+            mQueueFront = (mQueueFront + 1) % mQueue.size();
+            --mQueueSize;
+        }
+
+        write(mBuffers[buffer], frame);
+
+        {
+            std::lock_guard lock {mMutex};
+            mFree.push_back(buffer);
+            ++mCompleted;
+        }
+        mCompletedCondition.notify_all();
+    }
+}
+
+void FrameEncoder::write(const std::vector<std::byte>& frame, size_t index) {
+    TRACE_ZONE("FrameEncoder::write");
+
+    bool written {false};
+    if (mFormat == Format::Raw) {
+        mRawStream.write(reinterpret_cast<const char*>(frame.data()), static_cast<std::streamsize>(frame.size()));
+        written = mRawStream.good();
+    } else {
+        std::ostringstream name {};
+        name << "frame-" << std::setw(6) << std::setfill('0') << index << ".png";
+
+        const auto png {encodePng(mWidth, mHeight, frame)};
+        std::ofstream stream {mDirectory / name.str(), std::ios::binary | std::ios::trunc};
+        stream.write(reinterpret_cast<const char*>(png.data()), static_cast<std::streamsize>(png.size()));
+        written = stream.good();
+    }
+
+    // a full disk loses frames, not the game
+    (written ? mWritten : mDropped).fetch_add(1, std::memory_order_relaxed);
+}
+
+//endregion
+
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * Writes captured RGBA frames on its own thread, as one raw stream or as a numbered PNG per frame.
+ * Frames are copied into a fixed pool of buffers, so `submit()` never allocates and never waits for the disk:
+ * a frame that finds every buffer still queued is dropped and counted.
+ */
+class FrameEncoder {
+public:
+    enum class Format {Raw, Png};
+
+    /// Writes `frames.rgba`, or `frame-000000.png` on, into `directory`, created when missing
+    FrameEncoder(const std::filesystem::path& directory, Format format, unsigned int width, unsigned int height, size_t buffers = 8);
+
+    FrameEncoder(const FrameEncoder&) = delete;
+    FrameEncoder & operator=(const FrameEncoder&) = delete;
+    /// Writes what is still queued
+    ~FrameEncoder() noexcept;
+
+    /// Bottom row first, as GL reads them. False when the frame was dropped
+    bool submit(std::span<const std::byte> pixels);
+    /// Waits until every submitted frame is written
+    void flush();
+
+    inline size_t frameBytes() const {
+        return static_cast<size_t>(mWidth) * mHeight * 4;
+    }
+    inline size_t written() const {
+        return mWritten.load(std::memory_order_relaxed);
+    }
+    inline size_t dropped() const {
+        return mDropped.load(std::memory_order_relaxed);
+    }
+
+    /// PNG of top-down RGBA pixels, deflate without compression so it keeps up with the game
+    static std::vector<std::byte> encodePng(unsigned int width, unsigned int height, std::span<const std::byte> pixels);
+
+private:
+    void work(std::stop_token stopToken);
+    void write(const std::vector<std::byte>& frame, size_t index);
+
+private:
+    std::filesystem::path mDirectory;
+    Format mFormat;
+    unsigned int mWidth;
+    unsigned int mHeight;
+    std::ofstream mRawStream;
+
+    std::mutex mMutex;
+    std::condition_variable_any mQueued;
+    std::condition_variable mCompletedCondition;
+    std::vector<std::vector<std::byte>> mBuffers;
+    std::vector<size_t> mFree;
+    std::vector<size_t> mQueue; // ring of buffer indices
+    size_t mQueueFront {0};
+    size_t mQueueSize {0};
+    size_t mSubmitted {0};
+    size_t mCompleted {0};
+
+    std::atomic<size_t> mWritten {0};
+    std::atomic<size_t> mDropped {0};
+
+    std::jthread mThread;
+};
+
+}
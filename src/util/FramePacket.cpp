@@ -0,0 +1,30 @@
+#include "FramePacket.hpp"
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+FramePacket::FramePacket(size_t capacity)
+    : mArena{capacity}
+{}
+
+//endregion
+
+//region Public Methods
+
+void FramePacket::submit() const {
+    for (const auto& [run, command] : mCommands) {
+        run(command);
+    }
+}
+
+void FramePacket::reset() {
+    // the command list keeps its capacity, frames after warm-up do not allocate
+    mCommands.clear();
+    mArena.reset();
+    presentsTurn = false;
+}
+
+//endregion
+
+}
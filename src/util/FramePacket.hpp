@@ -0,0 +1,75 @@
+#pragma once
+
+#include <util/FrameArena.hpp>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * One frame between its two stages. `IObject::prepare()` builds the data of the frame in the arena and records
+ * the GL calls that use it, the GL thread `submit()`s them in order later, when the scene may have changed already.
+ * Commands are copied into the arena too, so they capture only what is trivially destructible:
+ * the object, values such as matrices, and spans into the arena.
+ */
+class FramePacket {
+public:
+    explicit FramePacket(size_t capacity = 256 * 1024);
+
+    FramePacket(FramePacket &&other) noexcept = default;
+    FramePacket & operator=(FramePacket &&other) noexcept = default;
+    ~FramePacket() noexcept = default;
+
+    /// Storage of this frame, valid until the packet is reset for a later one
+    template<typename T>
+    inline std::span<T> allocate(size_t count) {
+        return mArena.allocate<T>(count);
+    }
+
+    /// For helpers that allocate from an arena, the same storage as `allocate()`
+    inline FrameArena& arena() {
+        return mArena;
+    }
+
+    /// `command()` on the GL thread, after every command recorded before it
+    template<typename Command>
+    void record(Command&& command) {
+        using Stored = std::decay_t<Command>;
+        static_assert(std::is_trivially_destructible_v<Stored>, "Commands are never destroyed");
+
+        mCommands.push_back({
+            [](const void* command) { (*static_cast<const Stored*>(command))(); },
+            &mArena.create<Stored>(std::forward<Command>(command))
+        });
+    }
+
+    /// Runs the commands, on the thread with the GL context
+    void submit() const;
+    /// Forgets the commands and the data of the last frame
+    void reset();
+
+    inline size_t commands() const {
+        return mCommands.size();
+    }
+    /// Bytes of frame data and commands
+    inline size_t bytes() const {
+        return mArena.used();
+    }
+
+    /// Set when preparing the frame that first shows a typed turn, its present is timed
+    bool presentsTurn {false};
+
+private:
+    struct Entry {
+        void (*run)(const void* command);
+        const void* command;
+    };
+
+    FrameArena mArena;
+    std::vector<Entry> mCommands;
+};
+
+}
@@ -0,0 +1,48 @@
+#include "FramePipeline.hpp"
+
+namespace app::util {
+
+//region Public Methods
+
+FramePacket* FramePipeline::beginPrepare() {
+    std::uint64_t prepared {0};
+    {
+        std::lock_guard lock {mMutex};
+        if (mPreparedCount - mSubmittedCount == depth) {
+            return nullptr;
+        }
+        prepared = mPreparedCount;
+    }
+
+    // the GL thread is done with it, only the preparing thread touches it until `endPrepare()`
+    auto& packet {mPackets[prepared % depth]};
+    packet.reset();
+
+    return &packet;
+}
+
+void FramePipeline::endPrepare() {
+    {
+        std::lock_guard lock {mMutex};
+        ++mPreparedCount;
+    }
+    mPrepared.notify_one();
+}
+
+const FramePacket* FramePipeline::beginSubmit(std::stop_token stopToken) {
+    std::unique_lock lock {mMutex};
+    if (!mPrepared.wait(lock, stopToken, [this] { return mSubmittedCount < mPreparedCount; })) {
+        return nullptr;
+    }
+
+    return &mPackets[mSubmittedCount % depth];
+}
+
+void FramePipeline::endSubmit() {
+    std::lock_guard lock {mMutex};
+    ++mSubmittedCount;
+}
+
+//endregion
+
+}
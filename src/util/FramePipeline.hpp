@@ -0,0 +1,44 @@
+#pragma once
+
+#include <util/FramePacket.hpp>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <stop_token>
+
+namespace app::util {
+
+/**
+ * Frame packets on their way from the thread that prepares them to the GL thread, in order.
+ * With two packets the next frame is prepared while the GL thread submits and presents the last one;
+ * preparing one more waits until the GL thread is done with the oldest.
+ */
+class FramePipeline {
+public:
+    static constexpr size_t depth {2};
+
+    FramePipeline() = default;
+
+    FramePipeline(const FramePipeline&) = delete;
+    FramePipeline & operator=(const FramePipeline&) = delete;
+
+    /// An empty packet to prepare, nullptr while every packet waits for the GL thread
+    FramePacket* beginPrepare();
+    /// Hands the packet from `beginPrepare()` to the GL thread
+    void endPrepare();
+
+    /// The oldest prepared packet, waits for one; nullptr once `stopToken` is stopped
+    const FramePacket* beginSubmit(std::stop_token stopToken);
+    /// The packet from `beginSubmit()` can be prepared again
+    void endSubmit();
+
+private:
+    std::mutex mMutex;
+    std::condition_variable_any mPrepared;
+    std::array<FramePacket, depth> mPackets;
+    std::uint64_t mPreparedCount {0};
+    std::uint64_t mSubmittedCount {0};
+};
+
+}
@@ -0,0 +1,45 @@
+#include "FrameStats.hpp"
+#include <iomanip>
+#include <utility>
+
+namespace app::util {
+
+//region Public Methods
+
+void FrameStats::beginFrame() {
+    mFrame = {};
+}
+
+void FrameStats::endFrame() {
+    for (const auto culling : {&Frame::boardChunks, &Frame::snakeChunks}) {
+        (mTotal.*culling).visible += (mFrame.*culling).visible;
+        (mTotal.*culling).culled += (mFrame.*culling).culled;
+    }
+
+    mLastFrame = mFrame;
+    ++mFrames;
+}
+
+void FrameStats::report(std::ostream& stream) const {
+    constexpr std::pair<const char*, Culling Frame::*> layers[] {
+        {"board chunks", &Frame::boardChunks},
+        {"snake chunks", &Frame::snakeChunks},
+    };
+
+    const auto perFrame {[this](std::uint64_t count) {
+        return mFrames > 0 ? static_cast<double>(count) / mFrames : 0.0;
+    }};
+
+    stream << "frame statistics, " << mFrames << " frames:" << std::endl << std::fixed << std::setprecision(1);
+    for (const auto& [name, layer] : layers) {
+        stream
+            << "  " << std::left << std::setw(16) << name << std::right
+            << std::setw(10) << perFrame((mTotal.*layer).visible) << " visible"
+            << std::setw(10) << perFrame((mTotal.*layer).culled) << " culled per frame, last "
+            << (mLastFrame.*layer).visible << "/" << (mLastFrame.*layer).culled << std::endl;
+    }
+}
+
+//endregion
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+namespace app::util {
+
+/// Counters of the frames the scene renders, per frame and summed up for the report on exit
+class FrameStats {
+public:
+    struct Culling {
+        std::uint64_t visible {0};
+        std::uint64_t culled {0};
+    };
+
+    struct Frame {
+        Culling boardChunks;
+        Culling snakeChunks;
+    };
+
+    /// Zeroes the counts of the frame about to be rendered
+    void beginFrame();
+    void endFrame();
+
+    /// The frame being rendered, objects add their counts to it
+    inline Frame& frame() {
+        return mFrame;
+    }
+    inline const Frame& lastFrame() const {
+        return mLastFrame;
+    }
+    inline std::uint64_t frames() const {
+        return mFrames;
+    }
+
+    /// Averages per frame and the counts of the last frame
+    void report(std::ostream& stream) const;
+
+private:
+    Frame mFrame {};
+    Frame mLastFrame {};
+    Frame mTotal {};
+    std::uint64_t mFrames {0};
+};
+
+}
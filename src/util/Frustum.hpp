@@ -0,0 +1,38 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <array>
+
+namespace app::util {
+
+/// The six clip planes of a view-projection matrix, pointing inwards, for bounding box tests
+class Frustum {
+public:
+    Frustum() = default;
+    explicit Frustum(const glm::mat4& viewProjection) {
+        const auto row {[&](int i) { return glm::vec4{viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]}; }};
+
+        mPlanes = {
+            row(3) + row(0), row(3) - row(0), // left, right
+            row(3) + row(1), row(3) - row(1), // bottom, top
+            row(3) + row(2), row(3) - row(2), // near, far
+        };
+    }
+
+    /// False only when the box is wholly outside of a plane, boxes near corners may pass
+    inline bool intersects(const glm::vec3& min, const glm::vec3& max) const {
+        for (const auto& plane : mPlanes) {
+            // the corner furthest along the plane normal
+            const glm::vec3 corner {plane.x > 0 ? max.x : min.x, plane.y > 0 ? max.y : min.y, plane.z > 0 ? max.z : min.z};
+            if (glm::dot(glm::vec3{plane}, corner) + plane.w < 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::array<glm::vec4, 6> mPlanes {};
+};
+
+}
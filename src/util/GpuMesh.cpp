@@ -0,0 +1,64 @@
+#include "GpuMesh.hpp"
+#include <glad/glad.h>
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+GpuMesh::GpuMesh(const Mesh& mesh)
+    : mLods{mesh.lods().begin(), mesh.lods().end()}
+{
+    glGenVertexArrays(1, &mVao);
+    glGenBuffers(1, &mVbo);
+    glGenBuffers(1, &mEbo);
+
+    glBindVertexArray(mVao);
+
+    // straight from the mapped file, no copy on the way
+    glBindBuffer(GL_ARRAY_BUFFER, mVbo);
+    glBufferData(GL_ARRAY_BUFFER, mesh.vertices().size_bytes(), mesh.vertices().data(), GL_STATIC_DRAW);
+
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mEbo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices().size_bytes(), mesh.indices().data(), GL_STATIC_DRAW);
+
+    constexpr auto stride {static_cast<GLsizei>(Mesh::vertexFloats * sizeof(float))};
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, stride, (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, stride, (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+}
+
+GpuMesh::~GpuMesh() noexcept {
+    if (mVao != 0) {
+        glDeleteVertexArrays(1, &mVao);
+        glDeleteBuffers(1, &mVbo);
+        glDeleteBuffers(1, &mEbo);
+    }
+}
+
+//endregion
+
+//region Public Methods
+
+void GpuMesh::draw(size_t lod, size_t instances) const {
+    const auto& level {mLods[lod]};
+
+    glBindVertexArray(mVao);
+    glDrawElementsInstancedBaseVertex(
+        GL_TRIANGLES,
+        static_cast<GLsizei>(level.indexCount),
+        GL_UNSIGNED_INT,
+        (void*)(level.firstIndex * sizeof(std::uint32_t)),
+        static_cast<GLsizei>(instances),
+        static_cast<GLint>(level.firstVertex)
+    );
+    glBindVertexArray(0);
+}
+
+//endregion
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <util/Mesh.hpp>
+#include <utility>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * All LODs of a `Mesh` in one vertex and one index buffer, position at attribute 0 and color at 1.
+ * Instance attributes can be added to `vao()` by the owner.
+ */
+class GpuMesh {
+public:
+    explicit GpuMesh(const Mesh& mesh);
+
+    GpuMesh(const GpuMesh&) = delete;
+    GpuMesh& operator=(const GpuMesh&) = delete;
+    GpuMesh(GpuMesh &&other) noexcept
+        : mVao{std::exchange(other.mVao, 0)}
+        , mVbo{std::exchange(other.mVbo, 0)}
+        , mEbo{std::exchange(other.mEbo, 0)}
+        , mLods{std::move(other.mLods)}
+    {}
+    GpuMesh& operator=(GpuMesh &&other) noexcept {
+        std::swap(mVao, other.mVao);
+        std::swap(mVbo, other.mVbo);
+        std::swap(mEbo, other.mEbo);
+        std::swap(mLods, other.mLods);
+        return *this;
+    }
+    ~GpuMesh() noexcept;
+
+    inline unsigned int vao() const {
+        return mVao;
+    }
+    inline size_t lodFor(float cellPixels) const {
+        return Mesh::lodFor(mLods, cellPixels);
+    }
+    inline size_t triangles(size_t lod) const {
+        return mLods[lod].indexCount / 3;
+    }
+
+    /// Binds the VAO and draws `instances` copies of the LOD
+    void draw(size_t lod, size_t instances = 1) const;
+
+private:
+    unsigned int mVao {0};
+    unsigned int mVbo {0};
+    unsigned int mEbo {0};
+    std::vector<Mesh::Lod> mLods;
+};
+
+}
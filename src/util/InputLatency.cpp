@@ -0,0 +1,91 @@
+#include "InputLatency.hpp"
+#include <algorithm>
+#include <iomanip>
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+InputLatency::InputLatency() {
+    mSamples.reserve(capacity);
+}
+
+//endregion
+
+//region Public Methods
+
+void InputLatency::moved(Clock::time_point pressed, Clock::time_point time) {
+    mPressed = pressed;
+    mPending = {time - pressed, {}, {}};
+    mStage = Stage::Moved;
+}
+
+bool InputLatency::rendered(Clock::time_point time) {
+    if (mStage != Stage::Moved) {
+        return false;
+    }
+
+    mPending.render = time - mPressed;
+    mStage = Stage::Rendered;
+    return true;
+}
+
+void InputLatency::presented(Clock::time_point time) {
+    if (mStage != Stage::Rendered) {
+        return;
+    }
+
+    mPending.present = time - mPressed;
+    if (mSamples.size() < capacity) {
+        mSamples.push_back(mPending);
+    } else {
+        mSamples[mRecorded % capacity] = mPending;
+    }
+    ++mRecorded;
+    mStage = Stage::Idle;
+}
+
+InputLatency::Distribution InputLatency::distribution(Clock::duration Sample::* stage) const {
+    if (mSamples.empty()) {
+        return {};
+    }
+
+    std::vector<Clock::duration> values(mSamples.size());
+    std::transform(mSamples.begin(), mSamples.end(), values.begin(), [stage](const Sample& sample) {
+        return sample.*stage;
+    });
+    std::sort(values.begin(), values.end());
+
+    const auto percentile {[&values](size_t percent) {
+        return values[std::min(values.size() - 1, values.size() * percent / 100)];
+    }};
+
+    return {percentile(50), percentile(90), percentile(99), values.back()};
+}
+
+void InputLatency::report(std::ostream& stream) const {
+    constexpr std::pair<const char*, Clock::duration Sample::*> stages[] {
+        {"key to move", &Sample::move},
+        {"key to render", &Sample::render},
+        {"key to present", &Sample::present},
+    };
+
+    const auto milliseconds {[](Clock::duration duration) {
+        return std::chrono::duration<double, std::milli>{duration}.count();
+    }};
+
+    stream << "input latency, ms, " << mRecorded << " turns:" << std::endl << std::fixed << std::setprecision(1);
+    for (const auto& [name, stage] : stages) {
+        const auto distribution {this->distribution(stage)};
+        stream
+            << "  " << std::left << std::setw(16) << name << std::right
+            << " p50 " << std::setw(6) << milliseconds(distribution.p50)
+            << " p90 " << std::setw(6) << milliseconds(distribution.p90)
+            << " p99 " << std::setw(6) << milliseconds(distribution.p99)
+            << " max " << std::setw(6) << milliseconds(distribution.max) << std::endl;
+    }
+}
+
+//endregion
+
+}
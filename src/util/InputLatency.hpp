@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * Key press to screen. The press time of a turn follows it to the move that applies it,
+ * to the first render after that move and to the buffer swap that presents that frame.
+ * One turn is in flight at a time, a move never comes within a frame of the previous one.
+ * The latest `capacity` turns are kept, recording never allocates.
+ */
+class InputLatency {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // an hour of turns at one per move
+    static constexpr size_t capacity {12000};
+
+    /// Durations since the key press
+    struct Sample {
+        Clock::duration move;
+        Clock::duration render;
+        Clock::duration present;
+    };
+
+    struct Distribution {
+        Clock::duration p50;
+        Clock::duration p90;
+        Clock::duration p99;
+        Clock::duration max;
+    };
+
+    InputLatency();
+
+    void moved(Clock::time_point pressed, Clock::time_point time);
+    /// Only the first render after a move counts, true for that one; its frame is the one to present
+    bool rendered(Clock::time_point time);
+    void presented(Clock::time_point time);
+
+    /// Not in order once more than `capacity` turns were recorded
+    inline const std::vector<Sample>& samples() const {
+        return mSamples;
+    }
+    Distribution distribution(Clock::duration Sample::* stage) const;
+
+    /// Percentiles of every stage in milliseconds
+    void report(std::ostream& stream) const;
+
+private:
+    enum class Stage {Idle, Moved, Rendered};
+
+    Stage mStage {Stage::Idle};
+    Clock::time_point mPressed {};
+    Sample mPending {};
+    std::vector<Sample> mSamples;
+    size_t mRecorded {0};
+};
+
+}
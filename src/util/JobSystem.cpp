@@ -0,0 +1,92 @@
+#include "JobSystem.hpp"
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+JobSystem::JobSystem(unsigned int threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency()) - 1;
+    }
+
+    mWorkers.reserve(threads);
+    for (unsigned int worker = 0; worker < threads; ++worker) {
+        mWorkers.emplace_back([this](std::stop_token stopToken) {
+            work(stopToken);
+        });
+    }
+}
+
+JobSystem::~JobSystem() noexcept {
+    for (auto& worker : mWorkers) {
+        worker.request_stop();
+    }
+    mWorkers.clear();
+}
+
+//endregion
+
+//region Public Methods
+
+void JobSystem::submit(Counter& counter, Job job, void* context) {
+    counter.mPending.fetch_add(1, std::memory_order_relaxed);
+
+    {
+        std::unique_lock lock {mMutex};
+        if (mQueued < queueSize && !mWorkers.empty()) {
+            mQueue[(mFirst + mQueued) % queueSize] = {job, context, &counter};
+            ++mQueued;
+            lock.unlock();
+
+            mChanged.notify_one();
+            return;
+        }
+    }
+
+    // nobody to hand it to
+    job(context);
+    counter.mPending.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::wait(Counter& counter) {
+    std::unique_lock lock {mMutex};
+    while (!counter.done()) {
+        if (!runQueued(lock)) {
+            mChanged.wait(lock, [&] { return counter.done() || mQueued > 0; });
+        }
+    }
+}
+
+//endregion
+
+//region Private Methods
+
+bool JobSystem::runQueued(std::unique_lock<std::mutex>& lock) {
+    if (mQueued == 0) {
+        return false;
+    }
+
+    const auto entry {mQueue[mFirst]};
+    mFirst = (mFirst + 1) % queueSize;
+    --mQueued;
+    lock.unlock();
+
+    entry.job(entry.context);
+
+    lock.lock();
+    entry.counter->mPending.fetch_sub(1, std::memory_order_release);
+    mChanged.notify_all();
+
+    return true;
+}
+
+void JobSystem::work(std::stop_token stopToken) {
+    std::unique_lock lock {mMutex};
+    while (mChanged.wait(lock, stopToken, [this] { return mQueued > 0; })) {
+        runQueued(lock);
+    }
+}
+
+//endregion
+
+}
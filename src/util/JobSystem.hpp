@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * Worker threads taking jobs from one queue, for work that splits into independent pieces such as the instance data
+ * of a frame. A job is a function and a pointer, so queuing one never allocates; with the queue full it runs at once.
+ * `wait()` runs queued jobs on the waiting thread until its own are done, so a waiting thread never idles.
+ */
+class JobSystem {
+public:
+    using Job = void (*)(void* context);
+
+    static constexpr size_t queueSize {256};
+
+    /// Jobs of one batch not finished yet, `wait()` for them before it goes out of scope
+    class Counter {
+    public:
+        inline bool done() const {
+            return mPending.load(std::memory_order_acquire) == 0;
+        }
+
+    private:
+        friend class JobSystem;
+        std::atomic<size_t> mPending {0};
+    };
+
+    /// 0 - one per core besides the threads that wait
+    explicit JobSystem(unsigned int threads = 0);
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem & operator=(const JobSystem&) = delete;
+    ~JobSystem() noexcept;
+
+    void submit(Counter& counter, Job job, void* context);
+    void wait(Counter& counter);
+
+    /// `piece(begin, end)` for `[0, count)` in pieces of `grain`, on the workers and the calling thread. Rethrows the first failure
+    template<typename Piece>
+    void parallelFor(size_t count, size_t grain, Piece&& piece);
+
+    inline unsigned int workers() const {
+        return static_cast<unsigned int>(mWorkers.size());
+    }
+
+private:
+    struct Entry {
+        Job job;
+        void* context;
+        Counter* counter;
+    };
+
+    /// Runs the oldest queued job with `lock` released, false when there is none
+    bool runQueued(std::unique_lock<std::mutex>& lock);
+    void work(std::stop_token stopToken);
+
+private:
+    std::mutex mMutex;
+    // a job was queued or one finished
+    std::condition_variable_any mChanged;
+    std::array<Entry, queueSize> mQueue {};
+    size_t mFirst {0};
+    size_t mQueued {0};
+
+    std::vector<std::jthread> mWorkers;
+};
+
+template<typename Piece>
+void JobSystem::parallelFor(size_t count, size_t grain, Piece&& piece) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<size_t>(grain, 1);
+
+    // every thread takes the next piece until none are left, a slow piece holds up nobody else
+    struct Shared {
+        Piece* piece;
+        size_t count;
+        size_t grain;
+        std::atomic<size_t> next {0};
+        std::atomic<bool> failed {false};
+        std::exception_ptr error {};
+    };
+    Shared shared {&piece, count, grain};
+
+    const auto run {[](void* context) {
+        auto& shared {*static_cast<Shared*>(context)};
+        for (auto begin {shared.next.fetch_add(shared.grain)}; begin < shared.count; begin = shared.next.fetch_add(shared.grain)) {
+            try {
+                (*shared.piece)(begin, std::min(begin + shared.grain, shared.count));
+            } catch (...) {
+                if (!shared.failed.exchange(true)) {
+                    shared.error = std::current_exception();
+                }
+            }
+        }
+    }};
+
+    Counter counter {};
+    const auto pieces {(count + grain - 1) / grain};
+    for (size_t helper = 1; helper < pieces && helper <= mWorkers.size(); ++helper) {
+        submit(counter, run, &shared);
+    }
+    run(&shared);
+    wait(counter);
+
+    if (shared.error) {
+        std::rethrow_exception(shared.error);
+    }
+}
+
+}
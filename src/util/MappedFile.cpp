@@ -0,0 +1,75 @@
+#include "MappedFile.hpp"
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    std::ifstream file {path, std::ios::binary};
+    if (!file) {
+        throw std::runtime_error{"Unable to open " + path.string()};
+    }
+
+    mFallback.resize(std::filesystem::file_size(path));
+    file.read(reinterpret_cast<char*>(mFallback.data()), static_cast<std::streamsize>(mFallback.size()));
+    if (!file) {
+        throw std::runtime_error{"Unable to read " + path.string()};
+    }
+
+    mData = mFallback.data();
+    mSize = mFallback.size();
+}
+
+MappedFile::~MappedFile() noexcept = default;
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    const int fd {::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+    if (fd < 0) {
+        throw std::runtime_error{"Unable to open " + path.string()};
+    }
+
+    struct stat status {};
+    if (::fstat(fd, &status) != 0) {
+        ::close(fd);
+        throw std::runtime_error{"Unable to read " + path.string()};
+    }
+
+    mSize = static_cast<size_t>(status.st_size);
+    if (mSize > 0) {
+        void* data {::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0)};
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error{"Unable to map " + path.string()};
+        }
+        mData = static_cast<const std::byte*>(data);
+    }
+
+    // the mapping keeps the file alive
+    ::close(fd);
+}
+
+MappedFile::~MappedFile() noexcept {
+    if (mData != nullptr && mFallback.empty()) {
+        ::munmap(const_cast<std::byte*>(mData), mSize);
+    }
+}
+
+#endif
+
+//endregion
+
+}
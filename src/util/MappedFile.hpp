@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * Read-only memory mapping of a whole file, pages are read on first touch.
+ * Without `mmap` the file is read into memory instead.
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::filesystem::path& path);
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile &&other) noexcept
+        : mData{std::exchange(other.mData, nullptr)}
+        , mSize{std::exchange(other.mSize, 0)}
+        , mFallback{std::move(other.mFallback)}
+    {}
+    MappedFile& operator=(MappedFile &&other) noexcept {
+        std::swap(mData, other.mData);
+        std::swap(mSize, other.mSize);
+        std::swap(mFallback, other.mFallback);
+        return *this;
+    }
+    ~MappedFile() noexcept;
+
+    /// Page aligned, so any block at an aligned offset can be read in place
+    inline std::span<const std::byte> data() const {
+        return {mData, mSize};
+    }
+
+private:
+    const std::byte* mData {nullptr};
+    size_t mSize {0};
+    std::vector<std::byte> mFallback;
+};
+
+}
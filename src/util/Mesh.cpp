@@ -0,0 +1,204 @@
+#include "Mesh.hpp"
+#include <util/Cube.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace app::util {
+
+namespace {
+
+constexpr std::uint32_t fileMagic {0x4D4B4E53}; // "SNKM"
+constexpr std::uint32_t fileVersion {1};
+
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::uint32_t lodCount;
+    std::uint32_t vertexCount;
+    std::uint32_t indexCount;
+};
+
+static_assert(sizeof(Header) == 5 * sizeof(std::uint32_t));
+static_assert(sizeof(Mesh::Lod) == 5 * sizeof(std::uint32_t));
+
+constexpr size_t lodWords {sizeof(Mesh::Lod) / sizeof(std::uint32_t)};
+
+/// Byte size of a mesh file with these counts
+size_t fileSize(size_t lodCount, size_t vertexCount, size_t indexCount) {
+    return sizeof(Header) + lodCount * sizeof(Mesh::Lod)
+        + vertexCount * Mesh::vertexFloats * sizeof(float) + indexCount * sizeof(std::uint32_t);
+}
+
+}
+
+//region Public Methods
+
+Mesh Mesh::load(const std::filesystem::path& path) {
+    Mesh mesh {};
+    mesh.mFile = MappedFile{path};
+
+    const auto data {mesh.mFile.data()};
+    if (data.size() < sizeof(Header)) {
+        throw std::runtime_error{"Invalid mesh " + path.string()};
+    }
+
+    const auto& header {*reinterpret_cast<const Header*>(data.data())};
+    if (header.magic != fileMagic || header.version != fileVersion) {
+        throw std::runtime_error{"Invalid mesh " + path.string()};
+    }
+    if (data.size() != fileSize(header.lodCount, header.vertexCount, header.indexCount)) {
+        throw std::runtime_error{"Truncated mesh " + path.string()};
+    }
+
+    const auto* lods {reinterpret_cast<const Lod*>(data.data() + sizeof(Header))};
+    const auto* vertices {reinterpret_cast<const float*>(lods + header.lodCount)};
+    const auto* indices {reinterpret_cast<const std::uint32_t*>(vertices + header.vertexCount * vertexFloats)};
+
+    mesh.mLods = {lods, header.lodCount};
+    mesh.mVertices = {vertices, header.vertexCount * vertexFloats};
+    mesh.mIndices = {indices, header.indexCount};
+
+    try {
+        mesh.validate();
+    } catch (const std::runtime_error& error) {
+        throw std::runtime_error{std::string{error.what()} + " in " + path.string()};
+    }
+
+    return mesh;
+}
+
+Mesh Mesh::find(const std::string& name, Mesh fallback, const std::filesystem::path& directory) {
+    const auto path {directory / (name + ".mesh")};
+
+    std::error_code error {};
+    if (!std::filesystem::is_regular_file(path, error)) {
+        return fallback;
+    }
+
+    return load(path);
+}
+
+std::filesystem::path Mesh::defaultDirectory() {
+    if (const auto directory {std::getenv("SNAKE_MESH_DIR")}; directory != nullptr) {
+        return directory;
+    }
+    return std::filesystem::path{"assets"} / "meshes";
+}
+
+Mesh Mesh::cube(const glm::vec3& bottomColor, const glm::vec3& topColor) {
+    const auto [positions, cubeIndices] {Cube::indexed()};
+    const auto cubeVertices {positions.size() / 3};
+
+    // the top face alone, from far away the sides are a pixel or less
+    constexpr std::uint32_t topFace[] {4, 5, 6, 4, 6, 7};
+
+    const std::vector<Lod> lods {
+        {4.0f, 0, static_cast<std::uint32_t>(cubeVertices), 0, static_cast<std::uint32_t>(cubeIndices.size())},
+        {0.0f, static_cast<std::uint32_t>(cubeVertices), 4, static_cast<std::uint32_t>(cubeIndices.size()), 6},
+    };
+
+    std::vector<float> vertices {};
+    const auto pushVertex {[&](size_t vertex) {
+        const auto& color {vertex < 4 ? bottomColor : topColor};
+        vertices.insert(vertices.end(), positions.begin() + vertex * 3, positions.begin() + vertex * 3 + 3);
+        vertices.insert(vertices.end(), {color.r, color.g, color.b});
+    }};
+    for (size_t vertex = 0; vertex < cubeVertices; ++vertex) {
+        pushVertex(vertex);
+    }
+    for (size_t vertex = 4; vertex < 8; ++vertex) {
+        pushVertex(vertex);
+    }
+
+    std::vector<std::uint32_t> indices {cubeIndices.begin(), cubeIndices.end()};
+    for (const auto index : topFace) {
+        indices.push_back(index - 4);
+    }
+
+    // same layout as the file, minus the header
+    Mesh mesh {};
+    mesh.mStorage.resize((fileSize(lods.size(), vertices.size() / vertexFloats, indices.size()) - sizeof(Header)) / sizeof(std::uint32_t));
+
+    auto* storage {mesh.mStorage.data()};
+    std::memcpy(storage, lods.data(), lods.size() * sizeof(Lod));
+    std::memcpy(storage + lods.size() * lodWords, vertices.data(), vertices.size() * sizeof(float));
+    std::memcpy(storage + lods.size() * lodWords + vertices.size(), indices.data(), indices.size() * sizeof(std::uint32_t));
+
+    mesh.mLods = {reinterpret_cast<const Lod*>(storage), lods.size()};
+    mesh.mVertices = {reinterpret_cast<const float*>(storage + lods.size() * lodWords), vertices.size()};
+    mesh.mIndices = {storage + lods.size() * lodWords + vertices.size(), indices.size()};
+
+    mesh.validate();
+
+    return mesh;
+}
+
+void Mesh::write(
+    const std::filesystem::path& path,
+    std::span<const Lod> lods,
+    std::span<const float> vertices,
+    std::span<const std::uint32_t> indices
+) {
+    const Header header {
+        fileMagic,
+        fileVersion,
+        static_cast<std::uint32_t>(lods.size()),
+        static_cast<std::uint32_t>(vertices.size() / vertexFloats),
+        static_cast<std::uint32_t>(indices.size()),
+    };
+
+    std::ofstream file {path, std::ios::binary | std::ios::trunc};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(lods.data()), static_cast<std::streamsize>(lods.size_bytes()));
+    file.write(reinterpret_cast<const char*>(vertices.data()), static_cast<std::streamsize>(vertices.size_bytes()));
+    file.write(reinterpret_cast<const char*>(indices.data()), static_cast<std::streamsize>(indices.size_bytes()));
+    file.close();
+
+    if (!file) {
+        throw std::runtime_error{"Unable to write " + path.string()};
+    }
+}
+
+size_t Mesh::lodFor(std::span<const Lod> lods, float cellPixels) {
+    for (size_t lod = 0; lod < lods.size(); ++lod) {
+        if (cellPixels >= lods[lod].minCellPixels) {
+            return lod;
+        }
+    }
+
+    return lods.size() - 1;
+}
+
+//endregion
+
+//region Private Methods
+
+void Mesh::validate() const {
+    if (mLods.empty() || mVertices.size() % vertexFloats != 0) {
+        throw std::runtime_error{"Mesh without levels of detail"};
+    }
+
+    const auto vertexCount {mVertices.size() / vertexFloats};
+    for (const auto& lod : mLods) {
+        if (
+            static_cast<size_t>(lod.firstVertex) + lod.vertexCount > vertexCount
+            || static_cast<size_t>(lod.firstIndex) + lod.indexCount > mIndices.size()
+            || lod.indexCount % 3 != 0
+        ) {
+            throw std::runtime_error{"Mesh level of detail out of range"};
+        }
+
+        // a stray index would read past the vertices on the GPU
+        const auto lodIndices {mIndices.subspan(lod.firstIndex, lod.indexCount)};
+        if (std::any_of(lodIndices.begin(), lodIndices.end(), [&](auto index) { return index >= lod.vertexCount; })) {
+            throw std::runtime_error{"Mesh index out of range"};
+        }
+    }
+}
+
+//endregion
+
+}
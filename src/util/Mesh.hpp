@@ -0,0 +1,77 @@
+#pragma once
+
+#include <util/MappedFile.hpp>
+#include <glm/vec3.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * Triangle mesh with levels of detail, loaded from a memory-mapped `.mesh` file.
+ *
+ * The file is little-endian and 4-byte aligned, so both blocks go to buffer objects straight from the mapping:
+ * a header {"SNKM", version, LOD count, vertex count, index count}, the LOD table, the vertex block
+ * of interleaved position and color (6 floats) for all LODs, then the 32-bit index block.
+ * Indices count from the first vertex of their LOD. LODs go from the finest to the coarsest.
+ */
+class Mesh {
+public:
+    struct Lod {
+        float minCellPixels; // used while a board cell projects to at least this many pixels
+        std::uint32_t firstVertex;
+        std::uint32_t vertexCount;
+        std::uint32_t firstIndex;
+        std::uint32_t indexCount;
+    };
+
+    static constexpr size_t vertexFloats {6};
+
+    /// Throws for files that are not a valid mesh
+    static Mesh load(const std::filesystem::path& path);
+    /// `<directory>/<name>.mesh` when it exists, otherwise `fallback`
+    static Mesh find(const std::string& name, Mesh fallback, const std::filesystem::path& directory = defaultDirectory());
+    /// `SNAKE_MESH_DIR`, or `assets/meshes` in the working directory
+    static std::filesystem::path defaultDirectory();
+
+    /// The unit cube of `Cube::indexed()`, and only its top face once cells are smaller than 4 pixels
+    static Mesh cube(const glm::vec3& bottomColor, const glm::vec3& topColor);
+
+    static void write(
+        const std::filesystem::path& path,
+        std::span<const Lod> lods,
+        std::span<const float> vertices,
+        std::span<const std::uint32_t> indices
+    );
+
+    inline std::span<const Lod> lods() const {
+        return mLods;
+    }
+    inline std::span<const float> vertices() const {
+        return mVertices;
+    }
+    inline std::span<const std::uint32_t> indices() const {
+        return mIndices;
+    }
+
+    /// Finest of `lods` meant for cells of `cellPixels` on screen
+    static size_t lodFor(std::span<const Lod> lods, float cellPixels);
+
+private:
+    Mesh() = default;
+
+    void validate() const;
+
+private:
+    MappedFile mFile;
+    std::vector<std::uint32_t> mStorage; // built in meshes, laid out like a file
+
+    std::span<const Lod> mLods;
+    std::span<const float> mVertices;
+    std::span<const std::uint32_t> mIndices;
+};
+
+}
@@ -0,0 +1,137 @@
+#include "Metrics.hpp"
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+namespace app::util::metrics {
+
+namespace {
+
+std::vector<std::variant<const Counter*, const Histogram*>>& registered() {
+    static std::vector<std::variant<const Counter*, const Histogram*>> metrics {};
+    return metrics;
+}
+
+std::atomic<size_t> shards {0};
+
+/// Seconds without trailing zeros, as bucket labels
+void writeSeconds(std::ostream& stream, std::uint64_t nanoseconds) {
+    const auto flags {stream.flags()};
+    stream.unsetf(std::ios::floatfield);
+    stream.precision(9);
+    stream << static_cast<double>(nanoseconds) / 1e9;
+    stream.flags(flags);
+}
+
+}
+
+size_t nextShard() {
+    return shards.fetch_add(1, std::memory_order_relaxed) % shardCount;
+}
+
+//region Counter
+
+Counter::Counter(const char* name, const char* help)
+    : mName{name}
+    , mHelp{help}
+{
+    registered().emplace_back(this);
+}
+
+std::uint64_t Counter::value() const {
+    std::uint64_t value {0};
+    for (const auto& shard : mShards) {
+        value += shard.value.load(std::memory_order_relaxed);
+    }
+    return value;
+}
+
+void Counter::write(std::ostream& stream) const {
+    stream
+        << "# HELP " << mName << " " << mHelp << "\n"
+        << "# TYPE " << mName << " counter\n"
+        << mName << " " << value() << "\n";
+}
+
+//endregion
+
+//region Histogram
+
+Histogram::Histogram(const char* name, const char* help, std::initializer_list<std::chrono::nanoseconds> bounds)
+    : mName{name}
+    , mHelp{help}
+    , mBucketCount{bounds.size()}
+{
+    if (bounds.size() > maxBuckets) {
+        throw std::runtime_error{"Too many histogram buckets"};
+    }
+
+    std::transform(bounds.begin(), bounds.end(), mBounds.begin(), [](auto bound) {
+        return static_cast<std::uint64_t>(bound.count());
+    });
+    registered().emplace_back(this);
+}
+
+std::uint64_t Histogram::count() const {
+    std::uint64_t count {0};
+    for (const auto& shard : mShards) {
+        for (const auto& bucket : shard.buckets) {
+            count += bucket.load(std::memory_order_relaxed);
+        }
+    }
+    return count;
+}
+
+void Histogram::write(std::ostream& stream) const {
+    std::array<std::uint64_t, maxBuckets + 1> buckets {};
+    std::uint64_t sum {0};
+    for (const auto& shard : mShards) {
+        for (size_t bucket = 0; bucket <= mBucketCount; ++bucket) {
+            buckets[bucket] += shard.buckets[bucket].load(std::memory_order_relaxed);
+        }
+        sum += shard.sum.load(std::memory_order_relaxed);
+    }
+
+    stream
+        << "# HELP " << mName << " " << mHelp << "\n"
+        << "# TYPE " << mName << " histogram\n";
+
+    // buckets count everything up to their bound
+    std::uint64_t cumulative {0};
+    for (size_t bucket = 0; bucket < mBucketCount; ++bucket) {
+        cumulative += buckets[bucket];
+        stream << mName << "_bucket{le=\"";
+        writeSeconds(stream, mBounds[bucket]);
+        stream << "\"} " << cumulative << "\n";
+    }
+    cumulative += buckets[mBucketCount];
+
+    stream << mName << "_bucket{le=\"+Inf\"} " << cumulative << "\n" << mName << "_sum ";
+    writeSeconds(stream, sum);
+    stream << "\n" << mName << "_count " << cumulative << "\n";
+}
+
+//endregion
+
+void write(std::ostream& stream) {
+    for (const auto& metric : registered()) {
+        std::visit([&stream](const auto* metric) { metric->write(stream); }, metric);
+    }
+}
+
+using namespace std::chrono_literals;
+
+Counter ticks {"snake_ticks_total", "Scene ticks, from timers and keys"};
+Counter moves {"snake_moves_total", "Moves of the snake"};
+Counter treats {"snake_treats_total", "Treats eaten"};
+Counter framesRendered {"snake_frames_rendered_total", "Frames rendered and presented"};
+Counter framesDropped {"snake_frames_dropped_total", "Frame attempts that found the scene locked and tried again later"};
+Counter uploadBytes {"snake_upload_bytes_total", "Bytes uploaded to GPU buffers while playing"};
+Histogram lockWait {"snake_lock_wait_seconds", "Waits for the scene lock", {
+    1us, 10us, 50us, 100us, 500us, 1ms, 5ms, 10ms, 50ms, 100ms
+}};
+Histogram frameTime {"snake_frame_seconds", "Submitting and presenting a frame on the GL thread", {
+    500us, 1ms, 2ms, 4ms, 8ms, 16ms, 33ms, 50ms, 100ms, 250ms
+}};
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <ostream>
+
+namespace app::util::metrics {
+
+/*
+ * Runtime counters and histograms, written in the Prometheus text exposition format by `write()`.
+ * Every metric is a global defined once, registered before `main()`, so updating one never allocates or locks:
+ * it is a relaxed atomic add on the shard of the calling thread, each shard on its own cache line.
+ * Reading sums the shards.
+ */
+
+constexpr size_t shardCount {16};
+
+/// The next shard in turn, for a thread new to the metrics
+size_t nextShard();
+
+/// Shard of the calling thread
+inline size_t shard() {
+    thread_local const size_t threadShard {nextShard()};
+    return threadShard;
+}
+
+class Counter {
+public:
+    Counter(const char* name, const char* help);
+
+    Counter(const Counter&) = delete;
+    Counter & operator=(const Counter&) = delete;
+
+    inline void add(std::uint64_t value = 1) {
+        mShards[shard()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+    std::uint64_t value() const;
+
+    void write(std::ostream& stream) const;
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<std::uint64_t> value {0};
+    };
+
+    const char* mName;
+    const char* mHelp;
+    std::array<Shard, shardCount> mShards {};
+};
+
+/// Durations in buckets of upper bounds, exposed in seconds
+class Histogram {
+public:
+    static constexpr size_t maxBuckets {16};
+
+    Histogram(const char* name, const char* help, std::initializer_list<std::chrono::nanoseconds> bounds);
+
+    Histogram(const Histogram&) = delete;
+    Histogram & operator=(const Histogram&) = delete;
+
+    inline void observe(std::chrono::steady_clock::duration duration) {
+        const auto nanoseconds {static_cast<std::uint64_t>(std::max<std::int64_t>(0,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()
+        ))};
+
+        size_t bucket {0};
+        while (bucket < mBucketCount && nanoseconds > mBounds[bucket]) {
+            ++bucket;
+        }
+
+        auto& shard {mShards[metrics::shard()]};
+        shard.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        shard.sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+    /// Observations so far
+    std::uint64_t count() const;
+
+    void write(std::ostream& stream) const;
+
+private:
+    // the last bucket is above every bound
+    struct alignas(64) Shard {
+        std::array<std::atomic<std::uint64_t>, maxBuckets + 1> buckets {};
+        std::atomic<std::uint64_t> sum {0};
+    };
+
+    const char* mName;
+    const char* mHelp;
+    std::array<std::uint64_t, maxBuckets> mBounds {};
+    size_t mBucketCount {0};
+    std::array<Shard, shardCount> mShards {};
+};
+
+/// Every metric in the text exposition format, in the order they were defined
+void write(std::ostream& stream);
+
+// the game loop
+extern Counter ticks;
+extern Counter moves;
+extern Counter treats;
+extern Counter framesRendered;
+extern Counter framesDropped;
+extern Counter uploadBytes;
+extern Histogram lockWait;
+extern Histogram frameTime;
+
+}
@@ -0,0 +1,173 @@
+#include "MetricsExporter.hpp"
+#include <util/Metrics.hpp>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+MetricsExporter::MetricsExporter(std::uint16_t port, std::filesystem::path path, std::chrono::milliseconds interval)
+    : mPath{std::move(path)}
+    , mInterval{interval}
+{
+    if (port != 0) {
+#if defined(_WIN32)
+        throw std::runtime_error{"Serving metrics needs POSIX sockets"};
+#else
+        mListener = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (mListener < 0) {
+            throw std::runtime_error{"Unable to create the metrics socket"};
+        }
+
+        const int reuse {1};
+        ::setsockopt(mListener, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        // local only, metrics are for the collector on the same host
+        sockaddr_in address {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(port);
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::bind(mListener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || ::listen(mListener, 16) != 0) {
+            ::close(mListener);
+            throw std::runtime_error{"Unable to listen for metrics on port " + std::to_string(port)};
+        }
+#endif
+    }
+
+    mThread = std::jthread{[this](std::stop_token stopToken) { run(stopToken); }};
+}
+
+MetricsExporter::~MetricsExporter() noexcept {
+    mThread.request_stop();
+    mThread = {};
+
+#if !defined(_WIN32)
+    if (mListener >= 0) {
+        ::close(mListener);
+    }
+#endif
+
+    if (!mPath.empty()) {
+        try {
+            dump();
+        } catch (...) {}
+    }
+}
+
+//endregion
+
+//region Private Methods
+
+void MetricsExporter::run(std::stop_token stopToken) {
+    using Clock = std::chrono::steady_clock;
+    constexpr std::chrono::milliseconds stopCheckInterval {100};
+
+    auto nextDump {Clock::now() + mInterval};
+
+    while (!stopToken.stop_requested()) {
+        if (!mPath.empty() && Clock::now() >= nextDump) {
+            try {
+                dump();
+            } catch (const std::exception&) {
+                // tried again on the next interval
+            }
+            nextDump = Clock::now() + mInterval;
+        }
+
+        // without a file there is nothing to wake up for but the stop check
+        const auto timeout {mPath.empty() ? Clock::duration{stopCheckInterval} : std::min<Clock::duration>(stopCheckInterval, nextDump - Clock::now())};
+
+#if !defined(_WIN32)
+        if (mListener >= 0) {
+            pollfd listener {mListener, POLLIN, 0};
+            const auto milliseconds {std::chrono::duration_cast<std::chrono::milliseconds>(timeout).count()};
+            if (::poll(&listener, 1, static_cast<int>(std::max<long long>(0, milliseconds))) > 0) {
+                if (const int client {::accept4(mListener, nullptr, nullptr, SOCK_CLOEXEC)}; client >= 0) {
+                    serve(client);
+                    ::close(client);
+                }
+            }
+            continue;
+        }
+#endif
+
+        std::unique_lock lock {mMutex};
+        mStopped.wait_for(lock, stopToken, timeout, [] { return false; });
+    }
+}
+
+void MetricsExporter::serve(int client) {
+#if !defined(_WIN32)
+    // a slow client does not hold up the file dumps for long
+    const timeval timeout {1, 0};
+    ::setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ::setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    std::string request {};
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < 8192) {
+        const auto received {::recv(client, buffer, sizeof(buffer), 0)};
+        if (received <= 0) {
+            return;
+        }
+        request.append(buffer, static_cast<size_t>(received));
+    }
+
+    std::ostringstream body {};
+    std::string status {"200 OK"};
+    if (request.starts_with("GET /metrics ") || request.starts_with("GET / ")) {
+        metrics::write(body);
+    } else {
+        status = "404 Not Found";
+        body << "metrics are at /metrics\n";
+    }
+
+    std::ostringstream response {};
+    response
+        << "HTTP/1.1 " << status << "\r\n"
+        << "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+        << "Content-Length: " << body.str().size() << "\r\n"
+        << "Connection: close\r\n\r\n"
+        << body.str();
+
+    const auto text {response.str()};
+    for (size_t sent = 0; sent < text.size();) {
+        const auto written {::send(client, text.data() + sent, text.size() - sent, MSG_NOSIGNAL)};
+        if (written <= 0) {
+            return;
+        }
+        sent += static_cast<size_t>(written);
+    }
+#else
+    static_cast<void>(client);
+#endif
+}
+
+void MetricsExporter::dump() {
+    auto temporary {mPath};
+    temporary += ".tmp";
+
+    {
+        std::ofstream stream {temporary, std::ios::trunc};
+        metrics::write(stream);
+        if (!stream) {
+            throw std::runtime_error{"Unable to write " + temporary.string()};
+        }
+    }
+    std::filesystem::rename(temporary, mPath);
+}
+
+//endregion
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+
+namespace app::util {
+
+/**
+ * Publishes `metrics::write()` from one thread of its own: answers HTTP GETs on 127.0.0.1:`port`,
+ * and rewrites the file at `path` every `interval`, through a temporary file so readers never see half of one.
+ * A port of 0 or an empty path leaves that side off. Serving needs POSIX sockets.
+ */
+class MetricsExporter {
+public:
+    MetricsExporter(std::uint16_t port, std::filesystem::path path, std::chrono::milliseconds interval = std::chrono::seconds{10});
+
+    MetricsExporter(const MetricsExporter&) = delete;
+    MetricsExporter & operator=(const MetricsExporter&) = delete;
+    /// Writes the file a last time
+    ~MetricsExporter() noexcept;
+
+private:
+    void run(std::stop_token stopToken);
+    void serve(int client);
+    void dump();
+
+private:
+    int mListener {-1};
+    std::filesystem::path mPath;
+    std::chrono::milliseconds mInterval;
+    std::mutex mMutex;
+    std::condition_variable_any mStopped;
+    std::jthread mThread;
+};
+
+}
@@ -2,6 +2,7 @@
 
 #include <glad/glad.h>
 #include <glm/matrix.hpp>
+#include <glm/vec2.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 namespace app::util {
@@ -21,6 +22,12 @@ public:
     inline void setUniform(const char* name, const glm::mat4& value) const {
         glUniformMatrix4fv(glGetUniformLocation(mId, name), 1, GL_FALSE, glm::value_ptr(value));
     }
+    inline void setUniform(const char* name, float value) const {
+        glUniform1f(glGetUniformLocation(mId, name), value);
+    }
+    inline void setUniform(const char* name, const glm::uvec2& value) const {
+        glUniform2ui(glGetUniformLocation(mId, name), value.x, value.y);
+    }
 
 private:
     unsigned int mId;
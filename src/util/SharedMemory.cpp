@@ -0,0 +1,97 @@
+#include "SharedMemory.hpp"
+#include <stdexcept>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+#if defined(_WIN32)
+
+SharedMemory SharedMemory::create(const std::string&, size_t) {
+    throw std::runtime_error{"Shared memory needs POSIX"};
+}
+
+SharedMemory SharedMemory::open(const std::string&) {
+    throw std::runtime_error{"Shared memory needs POSIX"};
+}
+
+SharedMemory::~SharedMemory() noexcept = default;
+
+#else
+
+SharedMemory SharedMemory::create(const std::string& name, size_t size) {
+    // left over by a publisher that crashed
+    ::shm_unlink(name.c_str());
+
+    const int fd {::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600)};
+    if (fd < 0) {
+        throw std::runtime_error{"Unable to create shared memory " + name};
+    }
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        ::shm_unlink(name.c_str());
+        throw std::runtime_error{"Unable to size shared memory " + name};
+    }
+
+    void* data {::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)};
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        throw std::runtime_error{"Unable to map shared memory " + name};
+    }
+
+    SharedMemory memory {};
+    memory.mName = name;
+    memory.mData = static_cast<std::byte*>(data);
+    memory.mSize = size;
+    memory.mOwner = true;
+    return memory;
+}
+
+SharedMemory SharedMemory::open(const std::string& name) {
+    const int fd {::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0)};
+    if (fd < 0) {
+        throw std::runtime_error{"Unable to open shared memory " + name};
+    }
+
+    struct stat status {};
+    if (::fstat(fd, &status) != 0 || status.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error{"Unable to read shared memory " + name};
+    }
+
+    const auto size {static_cast<size_t>(status.st_size)};
+    void* data {::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0)};
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        throw std::runtime_error{"Unable to map shared memory " + name};
+    }
+
+    SharedMemory memory {};
+    memory.mName = name;
+    memory.mData = static_cast<std::byte*>(data);
+    memory.mSize = size;
+    return memory;
+}
+
+SharedMemory::~SharedMemory() noexcept {
+    if (mData != nullptr) {
+        ::munmap(mData, mSize);
+    }
+    if (mOwner) {
+        ::shm_unlink(mName.c_str());
+    }
+}
+
+#endif
+
+//endregion
+
+}
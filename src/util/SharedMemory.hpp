@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <utility>
+
+namespace app::util {
+
+/**
+ * Read-write mapping of a named POSIX shared-memory object, for state shared between processes.
+ * The creator owns the name and removes it again, mappings of other processes stay valid until they unmap.
+ * Not available on Windows.
+ */
+class SharedMemory {
+public:
+    SharedMemory() = default;
+
+    /// `name` is a single path component such as "/snake", an existing object of that name is replaced
+    static SharedMemory create(const std::string& name, size_t size);
+    /// Maps the whole object created under `name` by another process, read-only
+    static SharedMemory open(const std::string& name);
+
+    SharedMemory(const SharedMemory&) = delete;
+    SharedMemory& operator=(const SharedMemory&) = delete;
+    SharedMemory(SharedMemory &&other) noexcept
+        : mName{std::move(other.mName)}
+        , mData{std::exchange(other.mData, nullptr)}
+        , mSize{std::exchange(other.mSize, 0)}
+        , mOwner{std::exchange(other.mOwner, false)}
+    {}
+    SharedMemory& operator=(SharedMemory &&other) noexcept {
+        std::swap(mName, other.mName);
+        std::swap(mData, other.mData);
+        std::swap(mSize, other.mSize);
+        std::swap(mOwner, other.mOwner);
+        return *this;
+    }
+    ~SharedMemory() noexcept;
+
+    /// Page aligned, zero filled on creation
+    inline std::span<std::byte> data() const {
+        return {mData, mSize};
+    }
+
+private:
+    std::string mName;
+    std::byte* mData {nullptr};
+    size_t mSize {0};
+    bool mOwner {false};
+};
+
+}
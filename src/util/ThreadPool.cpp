@@ -0,0 +1,96 @@
+#include "ThreadPool.hpp"
+#include <algorithm>
+
+namespace app::util {
+
+//region Constructor & Destructor
+
+ThreadPool::ThreadPool(unsigned int threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    mWorkers.reserve(threads - 1);
+    for (unsigned int worker = 1; worker < threads; ++worker) {
+        mWorkers.emplace_back([this, worker](std::stop_token stopToken) {
+            work(stopToken, worker);
+        });
+    }
+}
+
+ThreadPool::~ThreadPool() noexcept {
+    for (auto& worker : mWorkers) {
+        worker.request_stop();
+    }
+    mWorkers.clear();
+}
+
+//endregion
+
+//region Public Methods
+
+void ThreadPool::run(const std::function<void(unsigned int)>& task) {
+    {
+        std::lock_guard lock {mMutex};
+        mTask = &task;
+        mRunning = static_cast<unsigned int>(mWorkers.size());
+        mError = nullptr;
+        ++mGeneration;
+    }
+    mStart.notify_all();
+
+    std::exception_ptr error {};
+    try {
+        task(0);
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    std::unique_lock lock {mMutex};
+    mDone.wait(lock, [this] { return mRunning == 0; });
+    mTask = nullptr;
+
+    if (!error) {
+        error = mError;
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+//endregion
+
+//region Private Methods
+
+void ThreadPool::work(std::stop_token stopToken, unsigned int worker) {
+    std::uint64_t generation {0};
+
+    for (;;) {
+        std::unique_lock lock {mMutex};
+        if (!mStart.wait(lock, stopToken, [&] { return mGeneration != generation; })) {
+            return;
+        }
+        generation = mGeneration;
+        const auto& task {*mTask};
+        lock.unlock();
+
+        std::exception_ptr error {};
+        try {
+            task(worker);
+        } catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if (error && !mError) {
+            mError = error;
+        }
+        if (--mRunning == 0) {
+            mDone.notify_one();
+        }
+    }
+}
+
+//endregion
+
+}
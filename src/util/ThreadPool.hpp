@@ -0,0 +1,49 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace app::util {
+
+/**
+ * Fixed workers for fork-join jobs: `run()` hands the same task to every worker,
+ * the calling thread included, and returns when all of them are done.
+ */
+class ThreadPool {
+public:
+    /// 0 - one per core
+    explicit ThreadPool(unsigned int threads = 0);
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool & operator=(const ThreadPool&) = delete;
+    ~ThreadPool() noexcept;
+
+    /// `task(worker)` with worker in `[0, size())`, the caller is worker 0. Rethrows the first failure
+    void run(const std::function<void(unsigned int)>& task);
+
+    inline unsigned int size() const {
+        return static_cast<unsigned int>(mWorkers.size()) + 1;
+    }
+
+private:
+    void work(std::stop_token stopToken, unsigned int worker);
+
+private:
+    std::mutex mMutex;
+    std::condition_variable_any mStart;
+    std::condition_variable mDone;
+
+    const std::function<void(unsigned int)>* mTask {nullptr};
+    std::uint64_t mGeneration {0};
+    unsigned int mRunning {0};
+    std::exception_ptr mError;
+
+    std::vector<std::jthread> mWorkers;
+};
+
+}
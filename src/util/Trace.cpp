@@ -0,0 +1,154 @@
+#include "Trace.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace app::util::trace {
+
+namespace {
+
+struct Event {
+    const char* name;
+    std::int64_t begin; // ns since the first event of the process
+    std::int64_t end; // -1 for instants
+};
+
+/// One writer, its own thread; readers see the events before `count`
+struct Buffer {
+    // about 20 minutes of the game at 200 zones per second, later events are dropped
+    static constexpr size_t capacity {1 << 18};
+
+    std::unique_ptr<Event[]> events {std::make_unique<Event[]>(capacity)};
+    std::atomic<size_t> count {0};
+    std::atomic<size_t> dropped {0};
+    std::atomic<const char*> threadName {nullptr};
+    unsigned int threadId;
+
+    explicit Buffer(unsigned int id) : threadId{id} {}
+
+    void push(const Event& event) {
+        const auto index {count.load(std::memory_order_relaxed)};
+        if (index == capacity) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        events[index] = event;
+        count.store(index + 1, std::memory_order_release);
+    }
+};
+
+struct Registry {
+    const Clock::time_point epoch {Clock::now()};
+    std::mutex mutex;
+    // buffers outlive their threads, exited threads stay on the timeline
+    std::vector<std::unique_ptr<Buffer>> buffers;
+};
+
+Registry& registry() {
+    static Registry instance {};
+    return instance;
+}
+
+Buffer& threadBuffer() {
+    thread_local Buffer* buffer {[] {
+        auto& registry {trace::registry()};
+        std::lock_guard lock {registry.mutex};
+
+        registry.buffers.push_back(std::make_unique<Buffer>(static_cast<unsigned int>(registry.buffers.size() + 1)));
+        return registry.buffers.back().get();
+    }()};
+
+    return *buffer;
+}
+
+std::int64_t sinceEpoch(Clock::time_point time) {
+    // the very first zone begins before the epoch is taken
+    return std::max<std::int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(time - registry().epoch).count());
+}
+
+void writeEscaped(std::ostream& stream, const char* text) {
+    for (; *text != '\0'; ++text) {
+        if (*text == '"' || *text == '\\') {
+            stream << '\\';
+        }
+        stream << *text;
+    }
+}
+
+}
+
+void record(const char* name, Clock::time_point begin, Clock::time_point end) {
+    threadBuffer().push({name, sinceEpoch(begin), sinceEpoch(end)});
+}
+
+void instant(const char* name) {
+    threadBuffer().push({name, sinceEpoch(Clock::now()), -1});
+}
+
+void setThreadName(const char* name) {
+    threadBuffer().threadName.store(name, std::memory_order_relaxed);
+}
+
+void write(const std::string& path) {
+    std::ofstream stream {path};
+    if (!stream) {
+        throw std::runtime_error{"Failed to open trace file " + path};
+    }
+
+    auto& registry {trace::registry()};
+    std::lock_guard lock {registry.mutex};
+
+    // microseconds with nanosecond decimals
+    const auto microseconds {[&stream](std::int64_t nanoseconds) -> std::ostream& {
+        return stream << nanoseconds / 1000 << '.' << std::to_string(1000 + nanoseconds % 1000).substr(1);
+    }};
+
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first {true};
+    const auto separator {[&]() -> std::ostream& {
+        stream << (first ? "" : ",\n");
+        first = false;
+        return stream;
+    }};
+
+    for (const auto& buffer : registry.buffers) {
+        const auto tid {buffer->threadId};
+
+        if (const auto name {buffer->threadName.load(std::memory_order_relaxed)}; name != nullptr) {
+            separator() << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << tid << R"(,"args":{"name":")";
+            writeEscaped(stream, name);
+            stream << "\"}}";
+        }
+        if (const auto dropped {buffer->dropped.load(std::memory_order_relaxed)}; dropped > 0) {
+            separator() << R"({"name":"dropped events","ph":"C","ts":0,"pid":1,"tid":)" << tid
+                << R"(,"args":{"dropped":)" << dropped << "}}";
+        }
+
+        const auto count {buffer->count.load(std::memory_order_acquire)};
+        for (size_t i = 0; i < count; ++i) {
+            const auto& event {buffer->events[i]};
+
+            separator() << R"({"name":")";
+            writeEscaped(stream, event.name);
+            stream << R"(","pid":1,"tid":)" << tid << ",\"ts\":";
+            microseconds(event.begin);
+
+            if (event.end < 0) {
+                stream << R"(,"ph":"i","s":"t"})";
+            } else {
+                stream << R"(,"ph":"X","dur":)";
+                microseconds(event.end - event.begin) << '}';
+            }
+        }
+    }
+
+    stream << "\n]}\n";
+}
+
+}
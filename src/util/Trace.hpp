@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+
+namespace app::util::trace {
+
+/*
+ * Timeline zones for chrome://tracing and ui.perfetto.dev. Every thread appends to its own buffer,
+ * `write()` turns them into trace-event JSON. Built with SNAKE_TRACING only, otherwise the macros are empty.
+ */
+
+#ifdef SNAKE_TRACING
+constexpr bool enabled {true};
+#else
+constexpr bool enabled {false};
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+void record(const char* name, Clock::time_point begin, Clock::time_point end);
+/// A point in time, e.g. a lock that was busy
+void instant(const char* name);
+/// Thread name shown on the timeline, `name` must outlive the trace
+void setThreadName(const char* name);
+/// Events recorded so far, threads may keep recording meanwhile
+void write(const std::string& path);
+
+/// Records the time from construction to destruction, `name` must outlive the trace
+class Zone {
+public:
+    explicit Zone(const char* name)
+        : mName{name}
+        , mBegin{Clock::now()}
+    {}
+
+    Zone(const Zone&) = delete;
+    Zone & operator=(const Zone&) = delete;
+
+    ~Zone() noexcept {
+        record(mName, mBegin, Clock::now());
+    }
+
+private:
+    const char* mName;
+    Clock::time_point mBegin;
+};
+
+}
+
+#ifdef SNAKE_TRACING
+#define SNAKE_TRACE_CONCAT_IMPL(a, b) a##b
+#define SNAKE_TRACE_CONCAT(a, b) SNAKE_TRACE_CONCAT_IMPL(a, b)
+#define TRACE_ZONE(name) const ::app::util::trace::Zone SNAKE_TRACE_CONCAT(traceZone, __COUNTER__) {name}
+#define TRACE_INSTANT(name) ::app::util::trace::instant(name)
+#define TRACE_THREAD(name) ::app::util::trace::setThreadName(name)
+#else
+#define TRACE_ZONE(name) static_cast<void>(0)
+#define TRACE_INSTANT(name) static_cast<void>(0)
+#define TRACE_THREAD(name) static_cast<void>(0)
+#endif